@@ -1,12 +1,26 @@
 #include <iostream>
 #include <ostream>
 #include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <thread>
 
 #include "Bus.h"
 #include "Rom.h"
 #include "olc6502.h"
+#include "Apple1Machine.h"
+#include "Apple1EmulationThread.h"
+#include "PtyBridge.h"
 #include "Apple1Terminal.h"
+#include "Apple1TerminalSprite.h"
 #include "Apple1Keyboard.h"
+#include "Apple1Paste.h"
+#include "IntegerBasic.h"
+#include "Apple1Console.h"
+#include "BatchRunner.h"
+#include "ParseNumber.h"
 
 #define OLC_PGE_APPLICATION
 #include "olcPixelGameEngine.h"
@@ -28,33 +42,132 @@ https://github.com/Klaus2m5/6502_65C02_functional_tests
 class Apple1 : public olc::PixelGameEngine
 {
 public:
+	std::shared_ptr<Apple1Machine> a1machine;
 	std::shared_ptr<Bus> a1bus;
 	std::shared_ptr<Apple1Terminal> a1term;
+	std::shared_ptr<Apple1TerminalSprite> a1screen;
+	std::shared_ptr<Apple1KeyboardQueue> a1kbdqueue;
 	std::shared_ptr<Apple1Keyboard> a1kbd;
+	std::shared_ptr<Apple1EmulationThread> a1emu;
+	std::shared_ptr<PtyBridge> a1serial;
 
 private:
+	Apple1Config config;
 	std::map<uint16_t, std::string> mapAsm;
-	bool runEmulator = true;
 	bool displayStatus = true;
 	bool displayCode = true;
-	float fResidualTime = 0;
+	bool displayPerf = true;
+	Apple1Config::Speed nSpeedBeforeWarp = Apple1Config::Speed::Clock;
+	std::string sPasteFile;
+	std::string sLoadFile;
+	std::string sSaveFile;
+	bool bRunOverride = false;
+	uint16_t nRunAddress = 0x0000;
+
+	// registers etc. of the emulation thread, taken once per frame
+	Apple1CpuState state;
+	Apple1CpuState stateLastFrame;
+
+	// performance panel - sums of the current window, the panel shows the last completed one
+	struct PerfStats
+	{
+		uint64_t nCycles = 0;
+		uint64_t nClockTicks = 0;
+		uint64_t nInstructions = 0;
+		uint32_t nFrames = 0;
+		float fFrame = 0.0f;
+		float fEmulate = 0.0f;		// busy time of the emulation thread
+		float fRender = 0.0f;
+		float fInput = 0.0f;
+	};
+	PerfStats perfWindow;
+	PerfStats perfShown;
+	uint32_t nPerfUpdates = 0;
+	const float fPerfRefresh = 0.25f;
+
+	// debug panel rendered into its own sprite, redrawn only when the state it shows changes
+	struct CachedPanel
+	{
+		olc::Sprite sprite;
+		std::vector<uint8_t> vKey;	// state the sprite was drawn from, empty = not drawn
+		CachedPanel(int32_t w, int32_t h) : sprite(w, h) {}
+	};
+	CachedPanel panelCpu = CachedPanel(270, 60);
+	CachedPanel panelCode = CachedPanel(270, 270);
+	CachedPanel panelPerf = CachedPanel(310, 60);
+	bool bLayoutChanged = true;
+	std::vector<uint16_t> vDirtyCells;
+
+	// frame pacing - full rate while anything happens, a few frames per second while the
+	// program just waits for a key and the screen does not change
+	std::chrono::steady_clock::time_point tNextFrame = std::chrono::steady_clock::now();
+	uint32_t nIdleFrames = 0;
+	const std::chrono::microseconds tActiveFrame = std::chrono::microseconds(16667);
+	const std::chrono::microseconds tIdleFrame = std::chrono::microseconds(66667);
+	const uint32_t nIdleAfterFrames = 30;
+	float fPanelTime = 0.0f;
+	// panels follow a running CPU at most this often, single steps are always shown
+	const float fPanelRefresh = 0.05f;
 
 public:
-	Apple1()
+	Apple1(const Apple1Config& config) :
+		config{ config }
 	{
 		sAppName = "Apple 1 Emulator";
 
-		a1bus = std::make_shared<Bus>();
-		a1term = std::make_shared<Apple1Terminal>(a1bus->pia);
-		a1kbd = std::make_shared<Apple1Keyboard>(a1bus->pia, (std::shared_ptr<olc::PixelGameEngine>)this);
-
-#ifdef TESTROM
-		// extract dissassembly
-		mapAsm = a1bus->cpu->disassemble(0x0000, 0xFFFF);
-#else
-		// extract dissassembly
-		mapAsm = a1bus->cpu->disassemble(a1bus->RomLow(), a1bus->RomHigh());
-#endif
+		displayStatus = config.bStatusPanel;
+		displayCode = config.bCodePanel;
+		displayPerf = config.bPerfPanel;
+		if (config.nSpeed != Apple1Config::Speed::Warp)
+			nSpeedBeforeWarp = config.nSpeed;
+
+		a1machine = std::make_shared<Apple1Machine>(config);
+		a1bus = a1machine->bus;
+		a1term = a1machine->term;
+		a1screen = std::make_shared<Apple1TerminalSprite>();
+		a1term->setSink(a1screen);
+		a1kbdqueue = a1machine->kbd;
+		a1emu = std::make_shared<Apple1EmulationThread>(a1machine, config);
+
+		// serial card to a host pty, its input wakes the emulation thread
+		if (a1bus->acia)
+		{
+			a1serial = std::make_shared<PtyBridge>(a1bus->acia);
+			std::string sError;
+			if (a1serial->Open(sError))
+				std::cerr << "serial card connected to " << a1serial->getName() << std::endl;
+			else
+				std::cerr << sError << std::endl;
+		}
+
+		a1kbd = std::make_shared<Apple1Keyboard>(a1emu, (std::shared_ptr<olc::PixelGameEngine>)this);
+
+		// extract dissassembly - of the ROMs, or all memory when the program is a RAM image
+		if (a1bus->roms.empty())
+			mapAsm = a1bus->cpu->disassemble(0x0000, 0xFFFF);
+		else
+			mapAsm = a1bus->cpu->disassemble(a1bus->RomLow(), a1bus->RomHigh());
+	}
+
+	void SetPasteFile(const std::string& sFileName)
+	{
+		sPasteFile = sFileName;
+	}
+
+	void SetLoadFile(const std::string& sSpec)
+	{
+		sLoadFile = sSpec;
+	}
+
+	void SetSaveFile(const std::string& sFileName)
+	{
+		sSaveFile = sFileName;
+	}
+
+	void SetRunAddress(uint16_t nAddr)
+	{
+		bRunOverride = true;
+		nRunAddress = nAddr;
 	}
 
 private:
@@ -94,28 +207,28 @@ private:
 	{
 		std::string status = "STATUS: ";
 		DrawString(x, y, "STATUS:", olc::WHITE);
-		DrawString(x + 64, y, "N", a1bus->cpu->status & olc6502::N ? olc::GREEN : olc::RED);
-		DrawString(x + 80, y, "V", a1bus->cpu->status & olc6502::V ? olc::GREEN : olc::RED);
-		DrawString(x + 96, y, "-", a1bus->cpu->status & olc6502::U ? olc::GREEN : olc::RED);
-		DrawString(x + 112, y, "B", a1bus->cpu->status & olc6502::B ? olc::GREEN : olc::RED);
-		DrawString(x + 128, y, "D", a1bus->cpu->status & olc6502::D ? olc::GREEN : olc::RED);
-		DrawString(x + 144, y, "I", a1bus->cpu->status & olc6502::I ? olc::GREEN : olc::RED);
-		DrawString(x + 160, y, "Z", a1bus->cpu->status & olc6502::Z ? olc::GREEN : olc::RED);
-		DrawString(x + 178, y, "C", a1bus->cpu->status & olc6502::C ? olc::GREEN : olc::RED);
-		DrawString(x, y + 10, "PC: $" + hex(a1bus->cpu->pc, 4));
-		DrawString(x, y + 20, "A: $" + hex(a1bus->cpu->a, 2) + "  [" + std::to_string(a1bus->cpu->a) + "]");
-		DrawString(x, y + 30, "X: $" + hex(a1bus->cpu->x, 2) + "  [" + std::to_string(a1bus->cpu->x) + "]");
-		DrawString(x, y + 40, "Y: $" + hex(a1bus->cpu->y, 2) + "  [" + std::to_string(a1bus->cpu->y) + "]");
-		DrawString(x, y + 50, "Stack P: $" + hex(a1bus->cpu->stkp, 4));
-
-		DrawString(x + 120, y + 10, "$FFFA: " + hex(a1bus->ram[0xFFFB], 2) + hex(a1bus->ram[0xFFFA], 2));
-		DrawString(x + 120, y + 20, "$FFFC: " + hex(a1bus->ram[0xFFFD], 2) + hex(a1bus->ram[0xFFFC], 2));
-		DrawString(x + 120, y + 30, "$FFFE: " + hex(a1bus->ram[0xFFFF], 2) + hex(a1bus->ram[0xFFFE], 2));
+		DrawString(x + 64, y, "N", state.status & olc6502::N ? olc::GREEN : olc::RED);
+		DrawString(x + 80, y, "V", state.status & olc6502::V ? olc::GREEN : olc::RED);
+		DrawString(x + 96, y, "-", state.status & olc6502::U ? olc::GREEN : olc::RED);
+		DrawString(x + 112, y, "B", state.status & olc6502::B ? olc::GREEN : olc::RED);
+		DrawString(x + 128, y, "D", state.status & olc6502::D ? olc::GREEN : olc::RED);
+		DrawString(x + 144, y, "I", state.status & olc6502::I ? olc::GREEN : olc::RED);
+		DrawString(x + 160, y, "Z", state.status & olc6502::Z ? olc::GREEN : olc::RED);
+		DrawString(x + 178, y, "C", state.status & olc6502::C ? olc::GREEN : olc::RED);
+		DrawString(x, y + 10, "PC: $" + hex(state.pc, 4));
+		DrawString(x, y + 20, "A: $" + hex(state.a, 2) + "  [" + std::to_string(state.a) + "]");
+		DrawString(x, y + 30, "X: $" + hex(state.x, 2) + "  [" + std::to_string(state.x) + "]");
+		DrawString(x, y + 40, "Y: $" + hex(state.y, 2) + "  [" + std::to_string(state.y) + "]");
+		DrawString(x, y + 50, "Stack P: $" + hex(state.stkp, 4));
+
+		DrawString(x + 120, y + 10, "$FFFA: " + hex(state.vectors[1], 2) + hex(state.vectors[0], 2));
+		DrawString(x + 120, y + 20, "$FFFC: " + hex(state.vectors[3], 2) + hex(state.vectors[2], 2));
+		DrawString(x + 120, y + 30, "$FFFE: " + hex(state.vectors[5], 2) + hex(state.vectors[4], 2));
 	}
 
 	void DrawCode(int x, int y, int nLines)
 	{
-		auto it_a = mapAsm.find(a1bus->cpu->pc);
+		auto it_a = mapAsm.find(state.pc);
 
 		int nLineY = (nLines >> 1) * 10 + y;
 		if (it_a != mapAsm.end())
@@ -131,7 +244,7 @@ private:
 			}
 		}
 
-		it_a = mapAsm.find(a1bus->cpu->pc);
+		it_a = mapAsm.find(state.pc);
 		nLineY = (nLines >> 1) * 10 + y;
 		if (it_a != mapAsm.begin())
 		{
@@ -146,92 +259,348 @@ private:
 		}
 	}
 
-	bool OnUserCreate()
+	void DrawPerf(int x, int y)
 	{
-		SystemReset();
+		const PerfStats& p = perfShown;
+		if (p.nFrames == 0 || p.fFrame <= 0.0f)
+			return;
 
-		return true;
+		auto Fixed = [](float f, int nDecimals)
+		{
+			std::ostringstream ss;
+			ss.setf(std::ios::fixed);
+			ss.precision(nDecimals);
+			ss << f;
+			return ss.str();
+		};
+
+		float fMHz = p.nCycles / p.fFrame / 1e6f;
+		float fClockMHz = p.nClockTicks / p.fFrame / 1e6f;
+		float fMs = 1000.0f / p.nFrames;
+
+		DrawString(x, y, "EMULATED: " + Fixed(fMHz, 3) + " MHZ" + (state.bWarping ? "  WARP" : ""), olc::WHITE);
+		// master clock (CPU cycles plus DRAM refresh) relative to the real Apple 1 clock,
+		// 14.31818 MHz / 14 - red when a clocked run falls behind
+		float fRatio = fClockMHz / 1.022727f;
+		bool bBehind = config.nSpeed == Apple1Config::Speed::Clock && fClockMHz * 1e6f < config.nClockHz * 0.95f;
+		DrawString(x, y + 10, "TARGET:   x" + Fixed(fRatio, 2), bBehind ? olc::RED : olc::WHITE);
+		DrawString(x, y + 20, "INSTR/FRAME: " + std::to_string(p.nInstructions / p.nFrames));
+		DrawString(x, y + 30, "FRAME: " + Fixed(p.fFrame * fMs, 1) + "MS  EMU " + Fixed(p.fEmulate * fMs, 1));
+		DrawString(x, y + 40, "RENDER " + Fixed(p.fRender * fMs, 1) + "  INPUT " + Fixed(p.fInput * fMs, 1));
+		DrawString(x, y + 50, "DSP QUEUE: " + std::to_string(a1term->getQueueSize()) + "  DROPPED: " + std::to_string(state.nDroppedKeys) +
+			(a1bus->acia ? " SER " + std::to_string(state.nDroppedSerial) : ""));
 	}
 
+	// copies the terminal cells that changed since the last frame to the screen at x, y,
+	// returns false when nothing changed
+	bool DrawTerminal(int x, int y, bool bAll)
+	{
+		a1screen->TakeDirtyCells(vDirtyCells);
 
-	void SystemReset()
+		uint8_t w = Apple1TerminalSprite::CharWidth();
+		uint8_t h = Apple1TerminalSprite::CharHeight();
+		int nCols = Apple1Terminal::Width() / w;
+
+		// after a scroll nearly every cell changed, one copy is cheaper then
+		if (bAll || vDirtyCells.size() > (size_t)nCols * 8)
+		{
+			DrawSprite(x, y, a1screen->getScreenSprite());
+			return true;
+		}
+
+		for (auto nCell : vDirtyCells)
+		{
+			int cx = (nCell % nCols) * w;
+			int cy = (nCell / nCols) * h;
+			DrawPartialSprite(x + cx, y + cy, a1screen->getScreenSprite(), cx, cy, w, h);
+		}
+
+		return !vDirtyCells.empty();
+	}
+
+	void PaceFrame(bool bActive)
 	{
-		// Reset
-		a1bus->cpu->reset();
+		nIdleFrames = bActive ? 0 : nIdleFrames + 1;
+		auto tFrame = nIdleFrames >= nIdleAfterFrames ? tIdleFrame : tActiveFrame;
+
+		// sleep away the rest of the frame; when late, start over from now instead of catching up
+		auto tNow = std::chrono::steady_clock::now();
+		tNextFrame = std::max(tNextFrame + tFrame, tNow);
+		if (tNextFrame > tNow)
+			std::this_thread::sleep_until(tNextFrame);
+	}
 
-		a1term->ClearScreen();
+	void DrawPanel(CachedPanel& panel, int x, int y, const std::vector<uint8_t>& vKey, const std::function<void()>& fnDraw)
+	{
+		if (panel.vKey == vKey)
+			return;
+
+		SetDrawTarget(&panel.sprite);
+		Clear(olc::DARK_BLUE);
+		fnDraw();
+		SetDrawTarget(nullptr);
+
+		panel.vKey = vKey;
+		DrawSprite(x, y, &panel.sprite);
 	}
 
-	bool OnUserUpdate(float fElapsedTime)
+	void DrawPanels(bool bFollowCpu)
 	{
-		// process 1 cpu instruction
-		if (runEmulator)
+		if (displayStatus && bFollowCpu)
 		{
-			do
-			{
-				a1bus->cpu->clock();
-			} while (!a1bus->cpu->complete());
+			std::vector<uint8_t> vKey = { state.a, state.x, state.y, state.stkp, state.status, (uint8_t)state.pc, (uint8_t)(state.pc >> 8) };
+			vKey.insert(vKey.end(), state.vectors, state.vectors + 6);
+			DrawPanel(panelCpu, 40 * 8 + 10, 2, vKey, [this]() { DrawCpu(0, 0); });
 		}
 
-#if TESTROM
-#else
-		// check for emulator keys pressed
-		if (GetKey(olc::Key::ESCAPE).bPressed)
+		if (displayCode && bFollowCpu && config.bPia)
 		{
-			SystemReset();
+			std::vector<uint8_t> vKey = { (uint8_t)state.pc, (uint8_t)(state.pc >> 8) };
+			DrawPanel(panelCode, 40 * 8 + 10, 72, vKey, [this]() { DrawCode(0, 0, 26); });
 		}
-#if DEBUGSCREEN
-		else if (GetKey(olc::Key::F2).bPressed)
+
+		if (displayPerf)
 		{
-			do
-			{
-				a1bus->cpu->clock();
-			} while (!a1bus->cpu->complete());
+			uint32_t nQueue = (uint32_t)a1term->getQueueSize();
+			uint32_t nDropped = state.nDroppedKeys;
+			std::vector<uint8_t> vKey(17);
+			memcpy(&vKey[0], &nPerfUpdates, 4);
+			memcpy(&vKey[4], &nQueue, 4);
+			memcpy(&vKey[8], &nDropped, 4);
+			memcpy(&vKey[12], &state.nDroppedSerial, 4);
+			vKey[16] = state.bWarping;
+			DrawPanel(panelPerf, 10, 2, vKey, [this]() { DrawPerf(0, 0); });
 		}
-		else if (GetKey(olc::Key::F3).bPressed)
+	}
+
+	bool OnUserCreate()
+	{
+		SystemReset();
+
+		if (!sLoadFile.empty())
+			LoadProgram();
+
+		if (!sPasteFile.empty())
+			Paste(Apple1Paste::ReadFile(sPasteFile));
+
+		// from here on the machine belongs to the emulation thread
+		a1emu->Start();
+		state = stateLastFrame = a1emu->getState();
+
+		return true;
+	}
+
+	bool OnUserDestroy()
+	{
+		a1emu->Stop();
+		return true;
+	}
+
+
+	// machine operations below run on the emulation thread while this thread waits -
+	// the terminal is only touched by one thread at a time
+
+	void SystemReset()
+	{
+		// Reset
+		a1emu->Execute([this]() { a1machine->Reset(); });
+	}
+
+	void StepInstruction()
+	{
+		a1emu->Step();
+	}
+
+	// F7 - warp on, or back to the speed it was switched on from
+	void ToggleWarp()
+	{
+		if (config.nSpeed == Apple1Config::Speed::Warp)
+			config.nSpeed = nSpeedBeforeWarp;
+		else
 		{
-			displayStatus = !displayStatus;
+			nSpeedBeforeWarp = config.nSpeed;
+			config.nSpeed = Apple1Config::Speed::Warp;
 		}
-		else if (GetKey(olc::Key::F4).bPressed)
+
+		a1emu->setSpeed(config.nSpeed);
+		UpdateTitle();
+	}
+
+	// the window title shows the effective speed while warp is on
+	void UpdateTitle()
+	{
+		if (config.nSpeed != Apple1Config::Speed::Warp)
+			sAppName = "Apple 1 Emulator";
+		else if (state.bWarping && perfShown.fFrame > 0.0f)
+			sAppName = "Apple 1 Emulator - warp " + std::to_string((int)(perfShown.nCycles / perfShown.fFrame / 1e6f)) + " MHz";
+		else
+			sAppName = "Apple 1 Emulator - warp, real time";
+	}
+
+	void LoadProgram()
+	{
+		a1emu->Execute([this]() {
+			a1machine->Load(sLoadFile);
+
+			if (bRunOverride)
+				a1machine->RunAt(nRunAddress);
+		});
+	}
+
+	void SaveProgram()
+	{
+		a1emu->Execute([this]() { IntegerBasic::SaveFile(*a1bus, sSaveFile); });
+	}
+
+	void Paste(const std::string& sText)
+	{
+		a1emu->Execute([this, &sText]() { a1kbdqueue->PushText(sText); });
+	}
+
+	bool OnUserUpdate(float fElapsedTime)
+	{
+		auto tFrameStart = std::chrono::steady_clock::now();
+
+		// the CPU runs on the emulation thread, paced by itself - only its state is picked up
+		state = a1emu->getState();
+		bool bPasting = state.nKeysQueued > 0;
+
+		// all output of the frame at once instead of one character per frame
+		bool bDrainOutput = bPasting || config.nSpeed != Apple1Config::Speed::Frame;
+
+		// check for emulator keys pressed - a test ROM has no keyboard
+		bool bInput = false;
+		if (config.bPia)
 		{
-			displayCode = !displayCode;
+			bInput = true;
+
+			if (GetKey(olc::Key::ESCAPE).bPressed)
+			{
+				SystemReset();
+			}
+			else if (GetKey(olc::Key::F8).bPressed)
+			{
+				Paste(Apple1Paste::ReadClipboard());
+			}
+			else if (GetKey(olc::Key::F9).bPressed && !sPasteFile.empty())
+			{
+				Paste(Apple1Paste::ReadFile(sPasteFile));
+			}
+			else if (GetKey(olc::Key::F10).bPressed && !sLoadFile.empty())
+			{
+				LoadProgram();
+			}
+			else if (GetKey(olc::Key::F11).bPressed && !sSaveFile.empty())
+			{
+				SaveProgram();
+			}
+			else if (GetKey(olc::Key::F7).bPressed)
+			{
+				ToggleWarp();
+			}
+			else if (config.bDebugScreen && GetKey(olc::Key::F2).bPressed)
+			{
+				StepInstruction();
+			}
+			else if (config.bDebugScreen && GetKey(olc::Key::F3).bPressed)
+			{
+				displayStatus = !displayStatus;
+				bLayoutChanged = true;
+			}
+			else if (config.bDebugScreen && GetKey(olc::Key::F4).bPressed)
+			{
+				displayCode = !displayCode;
+				bLayoutChanged = true;
+			}
+			else if (config.bDebugScreen && GetKey(olc::Key::F5).bPressed)
+			{
+				a1emu->setRunning(!a1emu->isRunning());
+			}
+			else if (config.bDebugScreen && GetKey(olc::Key::F6).bPressed)
+			{
+				displayPerf = !displayPerf;
+				bLayoutChanged = true;
+			}
+			else
+			{
+				// check for Apple1 Keyboard
+				bInput = a1kbd->ProcessKey();
+			}
 		}
-		else if (GetKey(olc::Key::F5).bPressed)
+
+		auto tInput = std::chrono::steady_clock::now();
+
+		bool bOutput = false;
+
+		if (config.bDebugScreen)
 		{
-			runEmulator = !runEmulator;
+			// the screen keeps its content between frames, it is only cleared
+			// when panels are switched on or off
+			if (bLayoutChanged)
+			{
+				Clear(olc::DARK_BLUE);
+
+				if (config.bPia)
+				{
+					DrawString(10, 370, "ESC = RESET  F2 = step  F8 = paste clipboard  F9 = paste file");
+					DrawString(10, 380, "F3 = status ON/OFF  F4 = code ON/OFF  F5 = single step ON/OFF");
+					DrawString(10, 390, "F6 = perf ON/OFF  F7 = warp ON/OFF  F10 = load  F11 = save BASIC");
+				}
+
+				panelCpu.vKey.clear();
+				panelCode.vKey.clear();
+				panelPerf.vKey.clear();
+			}
+
+			// single stepping shows every instruction, a running CPU is sampled
+			fPanelTime += fElapsedTime;
+			bool bFollowCpu = bLayoutChanged || !a1emu->isRunning() || !bDrainOutput || fPanelTime >= fPanelRefresh;
+			if (bFollowCpu)
+				fPanelTime = 0.0f;
+
+			DrawPanels(bFollowCpu);
+
+			if (config.bPia)
+			{
+				a1term->ProcessOutput();
+				while (bDrainOutput && a1term->ProcessOutput());
+
+				bOutput = DrawTerminal(0, 72, bLayoutChanged);
+			}
+
+			bLayoutChanged = false;
 		}
-#endif
 		else
 		{
-			// check for Apple1 Keyboard
-			a1kbd->ProcessKey();
+			// only the character cells changed by the output are copied
+			a1term->ProcessOutput();
+			while (bDrainOutput && a1term->ProcessOutput());
+
+			bOutput = DrawTerminal(0, 0, false);
 		}
-#endif
 
-#if DEBUGSCREEN
-		Clear(olc::DARK_BLUE);
+		auto tRendered = std::chrono::steady_clock::now();
+
+		perfWindow.nCycles += state.nCycles - stateLastFrame.nCycles;
+		perfWindow.nClockTicks += state.nClockTicks - stateLastFrame.nClockTicks;
+		perfWindow.nInstructions += state.nInstructions - stateLastFrame.nInstructions;
+		perfWindow.nFrames++;
+		perfWindow.fFrame += fElapsedTime;
+		perfWindow.fEmulate += (state.nBusyNanos - stateLastFrame.nBusyNanos) * 1e-9f;
+		perfWindow.fInput += std::chrono::duration<float>(tInput - tFrameStart).count();
+		perfWindow.fRender += std::chrono::duration<float>(tRendered - tInput).count();
 
-		if (displayStatus)
-			DrawCpu(40 * 8 + 10, 2);
-#if TESTROM
-#else
-		if (displayCode)
-			DrawCode(40 * 8 + 10, 72, 26);
-
-		DrawString(10, 370, "ESC = RESET  F2 = step");
-		DrawString(10, 380, "F3 = status ON/OFF  F4 = code ON/OFF  F5 = single step ON/OFF");
-
-		a1term->ProcessOutput();
-		DrawSprite(0, 72, a1term->getScreenSprite());
-#endif
-#else
-		// only refresh display when output changed
-		if (a1term->ProcessOutput())
+		stateLastFrame = state;
+
+		if (perfWindow.fFrame >= fPerfRefresh)
 		{
-			Clear(olc::BLACK);
-			DrawSprite(0, 0, a1term->getScreenSprite());
+			perfShown = perfWindow;
+			perfWindow = PerfStats();
+			nPerfUpdates++;
+			UpdateTitle();
 		}
-#endif
+
+		PaceFrame(bInput || bOutput || bPasting || !state.bWaitingForKey);
 
 		return true;
 	}
@@ -240,15 +609,74 @@ private:
 /*
 	Initialize and startup the actual emulation
 */
-int main()
+int main(int argc, char* argv[])
 {
-	auto demo = std::make_shared<Apple1>();
+	std::vector<std::string> vArgs(argv + 1, argv + argc);
+	std::vector<std::string> vRest;
+	std::string sError;
+
+	Apple1Config config;
+	if (!config.ParseArgs(vArgs, vRest, sError))
+	{
+		std::cerr << sError << std::endl;
+		return 1;
+	}
+
+	// headless batch of machines - no window
+	if (config.nFrontend == Apple1Config::Frontend::Batch)
+		return BatchRunner::Main(vRest, config);
+
+	// stdin/stdout terminal - no window
+	if (config.nFrontend == Apple1Config::Frontend::Console)
+		return Apple1Console::Main(vRest, config);
+
+	// checked before the window exists
+	std::string sPasteFile;
+	std::string sLoadFile;
+	std::string sSaveFile;
+	bool bRunOverride = false;
+	uint16_t nRunAddress = 0x0000;
+
+	for (size_t i = 0; i < vRest.size(); i++)
+	{
+		bool bValid = i + 1 < vRest.size();
+
+		// text file typed in after start, again with F9
+		if (bValid && vRest[i] == "--paste")
+			sPasteFile = vRest[++i];
+		// program loaded into RAM after start, again with F10
+		else if (bValid && vRest[i] == "--load")
+			sLoadFile = vRest[++i];
+		// BASIC program listed into a file with F11
+		else if (bValid && vRest[i] == "--save")
+			sSaveFile = vRest[++i];
+		else if (bValid && vRest[i] == "--run")
+		{
+			bValid = ParseAddress(vRest[++i], nRunAddress);
+			bRunOverride = true;
+		}
+		else
+			bValid = false;
+
+		if (!bValid)
+		{
+			std::cerr << "usage: olcApple1 [options] [--paste file] [--load file[@addr]] [--save file.bas] [--run addr]" << std::endl;
+			return 1;
+		}
+	}
+
+	auto demo = std::make_shared<Apple1>(config);
+
+	demo->SetPasteFile(sPasteFile);
+	demo->SetLoadFile(sLoadFile);
+	demo->SetSaveFile(sSaveFile);
+	if (bRunOverride)
+		demo->SetRunAddress(nRunAddress);
 
-#if DEBUGSCREEN
-	demo->Construct(600, 400, 2, 2);
-#else
-	demo->Construct(Apple1Terminal::Width(), Apple1Terminal::Height(), 2, 2);
-#endif
+	if (config.bDebugScreen)
+		demo->Construct(600, 400, 2, 2);
+	else
+		demo->Construct(Apple1Terminal::Width(), Apple1Terminal::Height(), 2, 2);
 
 	demo->Start();
 
@@ -0,0 +1,310 @@
+#include "Apple1Aci.h"
+#include "Bus.h"
+
+#include <algorithm>
+
+Apple1Aci::Apple1Aci(const Apple1Config& config)
+{
+	rom = std::make_shared<Rom>(config.sAciRom, 0xC100);
+
+	// the file was checked by Apple1Config
+	std::string sError;
+	bTape = !config.sTapeFile.empty() && wav.Open(config.sTapeFile, sError);
+	nTapeRate = bTape ? wav.getSampleRate() : 0;
+	nTapeTicks = 0;
+	nLastReadTicks = 0;
+	bInputLevel = false;
+	nCrossing = 0;
+	nBlockStart = 0;
+	nBand = -1;
+	nSignalRange = 0;
+	nHigh = 0;
+	nLow = 0;
+	nNextCrossing = bTape ? NextCrossing() : UINT64_MAX;
+
+	bRecord = !config.sRecordFile.empty() && wavOut.Open(config.sRecordFile, nRecordRate);
+	bOutputLevel = false;
+	nOutputTicks = 0;
+
+	bInstantLoad = config.bInstantLoad;
+	nReadEntry = FindReadRoutine();
+}
+
+Apple1Aci::~Apple1Aci()
+{
+	// the last level written, so the final edge is on the tape
+	if (bRecord)
+		wavOut.Write(bOutputLevel, (uint64_t)nPauseTicks * nRecordRate / nTapeClockHz);
+}
+
+bool Apple1Aci::ImageValid()
+{
+	return rom->ImageValid();
+}
+
+uint8_t Apple1Aci::cpuRead(uint16_t addr, uint64_t nTicks, bool bReadOnly)
+{
+	uint8_t data = 0x00;
+
+	if (addr >= 0xC100)
+	{
+		rom->cpuRead(addr, data);
+		return data;
+	}
+
+	// debugger reads neither toggle the output nor move the tape
+	bool bLevel = bInputLevel;
+	if (!bReadOnly)
+	{
+		ToggleOutput(nTicks);
+		bLevel = InputLevel(nTicks);
+	}
+
+	rom->cpuRead(0xC100 | (addr & 0xFE) | (bLevel ? 1 : 0), data);
+	return data;
+}
+
+void Apple1Aci::cpuWrite(uint16_t addr, uint64_t nTicks)
+{
+	// writes to the ROM are ignored
+	if (addr < 0xC100)
+		ToggleOutput(nTicks);
+}
+
+bool Apple1Aci::IsReadEntry(uint16_t pc)
+{
+	return pc == nReadEntry && nReadEntry != 0 && bInstantLoad && bTape;
+}
+
+void Apple1Aci::InstantLoad(Bus& bus)
+{
+	uint64_t nNow = bus.getClockTicks();
+	InputLevel(nNow);
+
+	// a half cycle ends at the next crossing, UINT64_MAX once the tape has ended
+	uint64_t nEdge = nTapeTicks * nTapeRate / nTapeClockHz;
+	auto HalfCycle = [this, &nEdge]()
+	{
+		if (nNextCrossing == UINT64_MAX)
+			return UINT64_MAX;
+
+		uint64_t nLength = nNextCrossing - nEdge;
+		nEdge = nNextCrossing;
+		bInputLevel = !bInputLevel;
+		nNextCrossing = NextCrossing();
+		return nLength;
+	};
+
+	// thresholds in samples as the routine counts them, 12 cycles per polling loop:
+	// a shorter half cycle is the start bit after the leader, a longer full cycle a 1
+	auto Samples = [this](uint32_t nLoops) { return (uint64_t)nLoops * 12 * nTapeRate / nTapeClockHz; };
+	const uint64_t nStartBit = Samples(31);
+	const uint64_t nOneBit = Samples(58);
+
+	// like the routine: a full cycle of the leader, the HCL delay, another full cycle,
+	// then wait for the start bit
+	HalfCycle();
+	HalfCycle();
+	uint64_t nDelayed = nEdge + nReadDelayCycles * nTapeRate / nTapeClockHz;
+	while (nNextCrossing <= nDelayed)
+		HalfCycle();
+	nEdge = nDelayed;
+	HalfCycle();
+	HalfCycle();
+	uint64_t nHalf;
+	do
+	{
+		nHalf = HalfCycle();
+	} while (nHalf != UINT64_MAX && nHalf >= nStartBit);
+	HalfCycle();
+
+	// $26/$27 current address, $24/$25 last address - stored until INCADDR sets the carry
+	uint16_t nAddr = bus.cpuRead(0x26, true) | (bus.cpuRead(0x27, true) << 8);
+	uint16_t nEnd = bus.cpuRead(0x24, true) | (bus.cpuRead(0x25, true) << 8);
+	bool bDone = false;
+
+	// eight full cycles, most significant bit first
+	auto ReadByte = [&](uint8_t& nByte)
+	{
+		for (int nBit = 0; nBit < 8; nBit++)
+		{
+			uint64_t nFirst = HalfCycle();
+			uint64_t nSecond = HalfCycle();
+			if (nSecond == UINT64_MAX)
+				return false;
+			nByte = (nByte << 1) | (nFirst + nSecond > nOneBit ? 1 : 0);
+		}
+		return true;
+	};
+
+	while (!bDone)
+	{
+		uint8_t nByte = 0;
+		if (!ReadByte(nByte))
+			break;
+
+		bus.cpuWrite(nAddr, nByte);
+		bDone = nAddr >= nEnd;
+		nAddr++;
+	}
+
+	// a tape that ends early returns to the prompt instead of waiting forever
+	nTapeTicks = nEdge * nTapeClockHz / nTapeRate;
+	nLastReadTicks = nNow;
+
+	// zero page and registers as the routine leaves them: X saved at $28, the last
+	// level read at $29, the CPU continues at its final BCS with the carry set
+	uint8_t nLevel = 0;
+	rom->cpuRead(0xC180 | (bInputLevel ? 1 : 0), nLevel);
+	bus.cpuWrite(0x26, nAddr & 0xFF);
+	bus.cpuWrite(0x27, nAddr >> 8);
+	bus.cpuWrite(0x28, bus.cpu->x);
+	bus.cpuWrite(0x29, nLevel);
+	bus.cpu->status |= olc6502::C;
+	bus.cpu->pc = nReadEntry + 0x2D;
+}
+
+bool Apple1Aci::InputLevel(uint64_t nTicks)
+{
+	if (!bTape)
+		return false;
+
+	// the tape only moves while it is read, a long pause is the user pressing stop
+	uint64_t nElapsed = nTicks - nLastReadTicks;
+	nLastReadTicks = nTicks;
+	if (nElapsed < nPauseTicks)
+		nTapeTicks += nElapsed;
+
+	uint64_t nSample = nTapeTicks * nTapeRate / nTapeClockHz;
+	while (nNextCrossing <= nSample)
+	{
+		bInputLevel = !bInputLevel;
+		nNextCrossing = NextCrossing();
+	}
+
+	return bInputLevel;
+}
+
+void Apple1Aci::ToggleOutput(uint64_t nTicks)
+{
+	if (bRecord)
+	{
+		// pauses between two saves are shortened to nPauseTicks
+		uint64_t nFrom = nOutputTicks;
+		if (nTicks - nFrom > nPauseTicks)
+			nFrom = nTicks - nPauseTicks;
+
+		wavOut.Write(bOutputLevel, nTicks * nRecordRate / nTapeClockHz - nFrom * nRecordRate / nTapeClockHz);
+	}
+
+	nOutputTicks = nTicks;
+	bOutputLevel = !bOutputLevel;
+}
+
+uint64_t Apple1Aci::NextCrossing()
+{
+	while (nCrossing == vCrossings.size())
+	{
+		if (!ReadBlock())
+			return UINT64_MAX;
+	}
+
+	return nBlockStart + vCrossings[nCrossing++];
+}
+
+bool Apple1Aci::ReadBlock()
+{
+	nBlockStart += vBlock.size();
+	vBlock.resize(nBlockSize);
+	size_t n = wav.Read(vBlock.data(), nBlockSize);
+	vBlock.resize(n);
+
+	vCrossings.clear();
+	nCrossing = 0;
+	if (n == 0)
+		return false;
+
+	// a Schmitt trigger, like the comparator of the card, with its band around the middle
+	// of the signal - minimum, maximum and the band of each sample are loops without
+	// branches that compile to SIMD code
+	int16_t nMin = vBlock[0];
+	int16_t nMax = vBlock[0];
+	for (size_t i = 0; i < n; i++)
+	{
+		nMin = std::min(nMin, vBlock[i]);
+		nMax = std::max(nMax, vBlock[i]);
+	}
+
+	// a block of silence or noise between recordings keeps the band of the signal before
+	int32_t nRange = nMax - nMin;
+	if (nRange * 2 >= nSignalRange)
+	{
+		nSignalRange = nRange;
+		nHigh = (nMax + nMin) / 2 + nRange / 8;
+		nLow = (nMax + nMin) / 2 - nRange / 8;
+	}
+
+	vBand.resize(n);
+	for (size_t i = 0; i < n; i++)
+		vBand[i] = (int8_t)((vBlock[i] > nHigh) - (vBlock[i] < nLow));
+
+	// the level flips where a sample leaves the band on the other side
+	for (size_t i = 0; i < n; i++)
+	{
+		if (vBand[i] == -nBand)
+		{
+			nBand = vBand[i];
+			vCrossings.push_back((uint32_t)i);
+		}
+	}
+
+	return true;
+}
+
+uint16_t Apple1Aci::FindReadRoutine()
+{
+	// the read routine of the ACI ROM from its entry to the final BCS, -1 = any byte
+	// (JSR targets), so a relocated or patched ROM is found as well
+	static const int16_t vSignature[] =
+	{
+		0x20, -1, -1,		// JSR FULLCYCLE
+		0xA9, 0x16,			// LDA #$16
+		0x20, -1, -1,		// JSR HCL
+		0x20, -1, -1,		// JSR FULLCYCLE
+		0xA0, 0x1F,			// NOTSTART: LDY #$1F
+		0x20, -1, -1,		// JSR CMPLEVEL
+		0xB0, 0xF9,			// BCS NOTSTART
+		0x20, -1, -1,		// JSR CMPLEVEL
+		0xA0, 0x3A,			// LDY #$3A
+		0xA2, 0x08,			// READBYTE: LDX #$08
+		0x48,				// READBIT: PHA
+		0x20, -1, -1,		// JSR FULLCYCLE
+		0x68,				// PLA
+		0x2A,				// ROL
+		0xA0, 0x39,			// LDY #$39
+		0xCA,				// DEX
+		0xD0, 0xF5,			// BNE READBIT
+		0x81, 0x26,			// STA ($26,X)
+		0x20, -1, -1,		// JSR INCADDR
+		0xA0, 0x35,			// LDY #$35
+		0x90, 0xEA,			// BCC READBYTE
+		0xB0				// BCS RESTIDX
+	};
+	const size_t nLength = sizeof(vSignature) / sizeof(vSignature[0]);
+
+	for (uint16_t nStart = 0xC100; nStart + nLength <= 0xC200; nStart++)
+	{
+		size_t i = 0;
+		for (; i < nLength; i++)
+		{
+			uint8_t data = 0x00;
+			if (!rom->cpuRead(nStart + (uint16_t)i, data) || (vSignature[i] >= 0 && data != vSignature[i]))
+				break;
+		}
+
+		if (i == nLength)
+			return nStart;
+	}
+
+	return 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Apple1Config.h"
+#include "Rom.h"
+#include "WavFile.h"
+
+class Bus;
+
+/*
+Apple Cassette Interface: the card's 256 byte ROM at $C100 and its I/O space
+$C000-$C0FF. Every access to $C0xx toggles the tape output flip-flop; a read
+returns the ROM byte with address bit 0 replaced by the tape input, so $C081
+reads $C180 or $C181 depending on the level and the ROM routines see the
+input change. The tape runs on the master clock (Bus::getClockTicks) while the
+program reads it and stops when it has not been read for a while, like
+pressing stop between two loads.
+
+Playback streams a WAV file: a block of samples is read at a time and its zero
+crossings are found in plain loops the compiler vectorises, the ROM routines
+then see the level flip at these positions. Recording writes the output
+flip-flop as a square wave WAV.
+
+Instant load: when the CPU enters the ROM's read routine (found by its code,
+not by address) the tape is decoded the same way the routine would, with the
+thresholds its polling loops count, and the bytes go straight to RAM. The CPU
+continues behind the routine as if it had read them in real time.
+*/
+
+class Apple1Aci
+{
+public:
+	Apple1Aci(const Apple1Config& config);
+	~Apple1Aci();
+
+public:
+	bool ImageValid();
+
+	// $C000-$C1FF, nTicks is the master clock
+	uint8_t cpuRead(uint16_t addr, uint64_t nTicks, bool bReadOnly);
+	void cpuWrite(uint16_t addr, uint64_t nTicks);
+
+	// instant load applies - a tape is inserted and the CPU is at the read routine
+	bool IsReadEntry(uint16_t pc);
+	void InstantLoad(Bus& bus);
+
+	// the clock the ROM timing loops were written for, 14.31818 MHz / 14
+	const static uint32_t nTapeClockHz = 1022727;
+
+private:
+	std::shared_ptr<Rom> rom;
+
+	// playback
+	WavReader wav;
+	bool bTape;
+	uint32_t nTapeRate;
+	uint64_t nTapeTicks;		// tape position in master clock ticks
+	uint64_t nLastReadTicks;
+	bool bInputLevel;
+	uint64_t nNextCrossing;		// sample index, UINT64_MAX at the end of the tape
+	const static uint64_t nPauseTicks = nTapeClockHz / 10;
+
+	// zero crossings of the current block
+	const static size_t nBlockSize = 4096;
+	std::vector<int16_t> vBlock;
+	std::vector<int8_t> vBand;		// 1 above, -1 below the hysteresis band, 0 inside
+	std::vector<uint32_t> vCrossings;
+	size_t nCrossing;
+	uint64_t nBlockStart;
+	int8_t nBand;				// side of the band the input was last on
+	int32_t nSignalRange;
+	int32_t nHigh;
+	int32_t nLow;
+
+	// recording
+	WavWriter wavOut;
+	bool bRecord;
+	bool bOutputLevel;
+	uint64_t nOutputTicks;		// master clock of the last toggle
+	const static uint32_t nRecordRate = 44100;
+
+	// instant load
+	bool bInstantLoad;
+	uint16_t nReadEntry;		// 0 = read routine not found in the ROM
+	// time the read routine spends in HCL between its first two full cycles
+	const static uint64_t nReadDelayCycles = 3338800;
+
+	bool InputLevel(uint64_t nTicks);
+	void ToggleOutput(uint64_t nTicks);
+	uint64_t NextCrossing();
+	bool ReadBlock();
+	uint16_t FindReadRoutine();
+};
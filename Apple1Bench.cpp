@@ -0,0 +1,472 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Apple1Machine.h"
+
+/*
+Microbenchmarks of the emulator hot paths, built against the core library only.
+Each benchmark is repeated with a doubling count until it runs for the minimum
+time, then one tab separated line is printed:
+
+	name	ops	ns/op	MHz
+
+MHz is the emulated 6502 clock reached (cycles per second of host time), "-"
+for benchmarks that do not execute CPU cycles. Arguments select benchmarks by
+substring, e.g. "olcApple1Bench -t 1 cpu.A9 bus.".
+*/
+
+struct Benchmark
+{
+	std::string sName;
+	// runs nReps repetitions, returns the ops done and adds the emulated cycles to nCycles
+	std::function<uint64_t(uint64_t nReps, uint64_t& nCycles)> fnRun;
+};
+
+// result sink, keeps the compiler from dropping reads
+static volatile uint8_t nSink = 0;
+
+static uint32_t StepInstruction(olc6502& cpu)
+{
+	uint32_t nCycles = 0;
+	do
+	{
+		cpu.clock();
+		nCycles++;
+	} while (!cpu.complete());
+	return nCycles;
+}
+
+// init sequence of the Woz monitor: DDRB output, both ports in data mode
+static void InitPia(MC6821& pia)
+{
+	pia.cpuWrite(0xD012, 0x7F);
+	pia.cpuWrite(0xD011, 0xA7);
+	pia.cpuWrite(0xD013, 0xA7);
+}
+
+// instruction length by addressing mode, taken from the disassembly "{XXX}" suffix
+static uint8_t InstructionLength(const std::string& sMode)
+{
+	if (sMode == "IMP")
+		return 1;
+	if (sMode == "ABS" || sMode == "ABX" || sMode == "ABY" || sMode == "IND")
+		return 3;
+	return 2;
+}
+
+/*
+One benchmark per documented opcode. The program at $1000 repeats the opcode up
+to $1F00 and jumps back, operands point to zero page $20, absolute $0400 or via
+the pointer at $10 (X = Y = 0). Branches have offset 0, so taken or not they
+continue with the next instruction. JSR and BRK are measured together with RTS
+and RTI (ns/op per instruction), which are therefore not listed on their own.
+*/
+static void AddCpuBenchmarks(std::vector<Benchmark>& vBenchmarks)
+{
+	Apple1Config config;
+	std::string sError;
+	config.Set("rom", "none", sError);
+	config.Set("pia", "off", sError);
+
+	Bus probe(config);
+
+	for (int op = 0; op < 256; op++)
+	{
+		probe.ram[0x0000] = (uint8_t)op;
+		std::string sLine = probe.cpu->disassemble(0x0000, 0x0000).begin()->second;
+		std::string sName = sLine.substr(7, 3);
+		std::string sMode = sLine.substr(sLine.size() - 4, 3);
+
+		if (sName == "???" || op == 0x40 || op == 0x60)
+			continue;
+
+		char sId[32];
+		if (op == 0x20)
+			snprintf(sId, sizeof(sId), "cpu.20.JSR+RTS");
+		else if (op == 0x00)
+			snprintf(sId, sizeof(sId), "cpu.00.BRK+RTI");
+		else
+			snprintf(sId, sizeof(sId), "cpu.%02X.%s.%s", op, sName.c_str(), sMode.c_str());
+
+		auto bus = std::make_shared<Bus>(config);
+		auto& ram = bus->ram;
+
+		ram[0x0010] = 0x00; ram[0x0011] = 0x04;	// ($10) -> $0400
+		ram[0x0200] = 0x60;						// JSR target: RTS
+		ram[0x0210] = 0x40;						// BRK handler: RTI
+		ram[0xFFFE] = 0x10; ram[0xFFFF] = 0x02;
+
+		uint16_t addr = 0x1000;
+		if (op == 0x6C)
+		{
+			// JMP ($0030) onto itself
+			ram[0x0030] = 0x00; ram[0x0031] = 0x10;
+			ram[addr++] = 0x6C; ram[addr++] = 0x30; ram[addr++] = 0x00;
+		}
+		else
+		{
+			uint8_t nLength = op == 0x00 ? 2 : InstructionLength(sMode);
+			while (addr + nLength <= 0x1F00)
+			{
+				uint16_t next = addr + nLength;
+				ram[addr] = (uint8_t)op;
+
+				if (op == 0x00)
+					ram[addr + 1] = 0xEA;	// BRK skips a padding byte
+				else if (op == 0x4C)
+				{
+					ram[addr + 1] = next & 0xFF; ram[addr + 2] = next >> 8;
+				}
+				else if (op == 0x20)
+				{
+					ram[addr + 1] = 0x00; ram[addr + 2] = 0x02;
+				}
+				else if (sMode == "IMM")
+					ram[addr + 1] = 0x01;
+				else if (sMode == "ZP0" || sMode == "ZPX" || sMode == "ZPY")
+					ram[addr + 1] = 0x20;
+				else if (sMode == "IZX" || sMode == "IZY")
+					ram[addr + 1] = 0x10;
+				else if (sMode == "REL")
+					ram[addr + 1] = 0x00;
+				else if (nLength == 3)
+				{
+					ram[addr + 1] = 0x00; ram[addr + 2] = 0x04;
+				}
+
+				addr = next;
+			}
+			ram[addr++] = 0x4C; ram[addr++] = 0x00; ram[addr++] = 0x10;
+		}
+
+		bus->cpu->pc = 0x1000;
+		bus->cpu->stkp = 0xFD;
+		bus->cpu->status = olc6502::U;
+
+		vBenchmarks.push_back({ sId, [bus](uint64_t nReps, uint64_t& nCycles)
+		{
+			olc6502& cpu = *bus->cpu;
+			for (uint64_t i = 0; i < nReps; i++)
+			{
+				nCycles += StepInstruction(cpu);
+				// X and Y changing opcodes must not move the indexed operands around
+				cpu.x = cpu.y = 0;
+			}
+			return nReps;
+		} });
+	}
+}
+
+static void AddBusBenchmarks(std::vector<Benchmark>& vBenchmarks)
+{
+	auto bus = std::make_shared<Bus>();
+	InitPia(*bus->pia);
+
+	vBenchmarks.push_back({ "bus.read.ram", [bus](uint64_t nReps, uint64_t&)
+	{
+		uint8_t n = 0;
+		for (uint64_t i = 0; i < nReps; i++)
+			n += bus->cpuRead((uint16_t)(i & 0x0FFF));
+		nSink = n;
+		return nReps;
+	} });
+
+	vBenchmarks.push_back({ "bus.read.rom", [bus](uint64_t nReps, uint64_t&)
+	{
+		uint8_t n = 0;
+		for (uint64_t i = 0; i < nReps; i++)
+			n += bus->cpuRead((uint16_t)(0xE000 | (i & 0x0FFF)));
+		nSink = n;
+		return nReps;
+	} });
+
+	vBenchmarks.push_back({ "bus.read.pia", [bus](uint64_t nReps, uint64_t&)
+	{
+		uint8_t n = 0;
+		for (uint64_t i = 0; i < nReps; i++)
+			n += bus->cpuRead((uint16_t)(0xD010 | (i & 0x03)));
+		nSink = n;
+		return nReps;
+	} });
+
+	vBenchmarks.push_back({ "bus.write.ram", [bus](uint64_t nReps, uint64_t&)
+	{
+		for (uint64_t i = 0; i < nReps; i++)
+			bus->cpuWrite((uint16_t)(i & 0x0FFF), (uint8_t)i);
+		return nReps;
+	} });
+
+	vBenchmarks.push_back({ "bus.write.pia", [bus](uint64_t nReps, uint64_t&)
+	{
+		for (uint64_t i = 0; i < nReps; i++)
+			bus->cpuWrite(0xD012, (uint8_t)(0x80 | (i & 0x3F)));
+		return nReps;
+	} });
+}
+
+static void AddPiaBenchmarks(std::vector<Benchmark>& vBenchmarks)
+{
+	auto pia = std::make_shared<MC6821>();
+	InitPia(*pia);
+
+	// KBDCR poll of the monitor's key wait loop
+	vBenchmarks.push_back({ "pia.kbdcr.read", [pia](uint64_t nReps, uint64_t&)
+	{
+		uint8_t n = 0;
+		for (uint64_t i = 0; i < nReps; i++)
+			n += pia->cpuRead(0xD011);
+		nSink = n;
+		return nReps;
+	} });
+
+	// key strobe on CA1 and read of KBD, which clears the flag again
+	vBenchmarks.push_back({ "pia.kbd.key", [pia](uint64_t nReps, uint64_t&)
+	{
+		uint8_t n = 0;
+		for (uint64_t i = 0; i < nReps; i++)
+		{
+			pia->setInputA((uint8_t)(0xC1 + (i & 0x0F)));
+			pia->setCA1(Signal::Fall);
+			pia->setCA1(Signal::Rise);
+			n += pia->cpuRead(0xD010);
+		}
+		nSink = n;
+		return nReps;
+	} });
+
+	vBenchmarks.push_back({ "pia.dsp.write", [pia](uint64_t nReps, uint64_t&)
+	{
+		for (uint64_t i = 0; i < nReps; i++)
+			pia->cpuWrite(0xD012, (uint8_t)(0x80 | (i & 0x3F)));
+		return nReps;
+	} });
+}
+
+static void AddTerminalBenchmarks(std::vector<Benchmark>& vBenchmarks)
+{
+	// characters without scrolling, the screen is cleared before it would scroll
+	{
+		auto pia = std::make_shared<MC6821>();
+		auto term = std::make_shared<Apple1Terminal>(pia);
+		InitPia(*pia);
+
+		vBenchmarks.push_back({ "terminal.char", [pia, term](uint64_t nReps, uint64_t&)
+		{
+			for (uint64_t i = 0; i < nReps; i++)
+			{
+				if (i % (40 * 23) == 0)
+					term->ClearScreen();
+				pia->cpuWrite(0xD012, (uint8_t)(0xC1 + (i % 26)));
+				term->ProcessOutput();
+			}
+			return nReps;
+		} });
+	}
+
+	// carriage returns on the bottom line, each one scrolls the screen
+	{
+		auto pia = std::make_shared<MC6821>();
+		auto term = std::make_shared<Apple1Terminal>(pia);
+		InitPia(*pia);
+
+		for (int i = 0; i < 24; i++)
+		{
+			pia->cpuWrite(0xD012, 0x8D);
+			term->ProcessOutput();
+		}
+
+		vBenchmarks.push_back({ "terminal.scroll", [pia, term](uint64_t nReps, uint64_t&)
+		{
+			for (uint64_t i = 0; i < nReps; i++)
+			{
+				pia->cpuWrite(0xD012, 0x8D);
+				term->ProcessOutput();
+			}
+			return nReps;
+		} });
+	}
+}
+
+static void AddKeyboardBenchmarks(std::vector<Benchmark>& vBenchmarks)
+{
+	// queue in, PIA out as the CPU reads KBD
+	{
+		auto pia = std::make_shared<MC6821>();
+		auto kbd = std::make_shared<Apple1KeyboardQueue>(pia);
+		InitPia(*pia);
+
+		vBenchmarks.push_back({ "keyboard.queue", [pia, kbd](uint64_t nReps, uint64_t&)
+		{
+			uint8_t n = 0;
+			for (uint64_t i = 0; i < nReps; i++)
+			{
+				kbd->PushKey((uint8_t)(0x41 + (i & 0x0F)));
+				kbd->Clock(1);
+				n += pia->cpuRead(0xD010);
+			}
+			nSink = n;
+			return nReps;
+		} });
+	}
+
+	// keys typed into the Woz monitor on a complete machine, ops are keys
+	{
+		auto machine = std::make_shared<Apple1Machine>();
+		machine->Reset();
+		machine->Run(1000000);
+
+		vBenchmarks.push_back({ "keyboard.monitor", [machine](uint64_t nReps, uint64_t& nCycles)
+		{
+			static const std::string sLine = "FF00.FF0F\r";
+			std::string sText;
+			for (uint64_t i = 0; i < nReps; i++)
+				sText += sLine[i % sLine.size()];
+
+			uint64_t nStart = machine->getCycles();
+			machine->TypeText(sText);
+			while (machine->Run(100000000) == Apple1Machine::ExitReason::CycleBudget);
+			nCycles += machine->getCycles() - nStart;
+			return nReps;
+		} });
+	}
+
+	// the monitor waiting for a key with each DRAM refresh model, ops are instructions
+	static const std::pair<const char*, Apple1Config::Refresh> vRefresh[] =
+	{
+		{ "machine.monitor.idle", Apple1Config::Refresh::Batch },
+		{ "machine.monitor.idle.refresh-exact", Apple1Config::Refresh::Exact },
+		{ "machine.monitor.idle.refresh-off", Apple1Config::Refresh::Off }
+	};
+
+	for (auto& r : vRefresh)
+	{
+		Apple1Config config;
+		config.nRefresh = r.second;
+		auto machine = std::make_shared<Apple1Machine>(config);
+		machine->Reset();
+		machine->Run(1000000);
+
+		vBenchmarks.push_back({ r.first, [machine](uint64_t nReps, uint64_t& nCycles)
+		{
+			uint64_t nStart = machine->getCycles();
+			for (uint64_t i = 0; i < nReps; i++)
+				machine->Step();
+			nCycles += machine->getCycles() - nStart;
+			nSink = (uint8_t)machine->bus->getClockTicks();
+			return nReps;
+		} });
+	}
+}
+
+static void AddDisassemblyBenchmarks(std::vector<Benchmark>& vBenchmarks)
+{
+	auto bus = std::make_shared<Bus>();
+
+	// whole BASIC ROM per repetition, ops are disassembled instructions
+	vBenchmarks.push_back({ "disassemble.basic", [bus](uint64_t nReps, uint64_t&)
+	{
+		uint64_t nOps = 0;
+		for (uint64_t i = 0; i < nReps; i++)
+			nOps += bus->cpu->disassemble(0xE000, 0xEFFF).size();
+		return nOps;
+	} });
+}
+
+static bool Selected(const std::string& sName, const std::vector<std::string>& vFilters)
+{
+	if (vFilters.empty())
+		return true;
+
+	for (auto& f : vFilters)
+	{
+		if (sName.find(f) != std::string::npos)
+			return true;
+	}
+	return false;
+}
+
+int main(int argc, char* argv[])
+{
+	const std::string sUsage = "usage: olcApple1Bench [-t seconds] [name filter ...]";
+	double fMinTime = 0.2;
+	std::vector<std::string> vFilters;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string a = argv[i];
+
+		if (a == "-t" && i + 1 < argc)
+		{
+			// whole argument, positive and finite
+			const char* pValue = argv[++i];
+			char* pEnd = nullptr;
+			fMinTime = std::strtod(pValue, &pEnd);
+			if (pEnd == pValue || *pEnd != '\0' || !(fMinTime > 0.0) || !std::isfinite(fMinTime))
+			{
+				std::cerr << "invalid value " << pValue << " for -t" << std::endl << sUsage << std::endl;
+				return 1;
+			}
+		}
+		else if (a[0] == '-')
+		{
+			std::cerr << sUsage << std::endl;
+			return 1;
+		}
+		else
+			vFilters.push_back(a);
+	}
+
+	std::vector<Benchmark> vBenchmarks;
+	AddCpuBenchmarks(vBenchmarks);
+	AddBusBenchmarks(vBenchmarks);
+	AddPiaBenchmarks(vBenchmarks);
+	AddTerminalBenchmarks(vBenchmarks);
+	AddKeyboardBenchmarks(vBenchmarks);
+	AddDisassemblyBenchmarks(vBenchmarks);
+
+	std::cout << "# benchmark\tops\tns/op\tMHz" << std::endl;
+
+	for (auto& b : vBenchmarks)
+	{
+		if (!Selected(b.sName, vFilters))
+			continue;
+
+		uint64_t nReps = 1;
+		uint64_t nOps = 0;
+		uint64_t nCycles = 0;
+		double fSeconds = 0.0;
+
+		while (true)
+		{
+			nCycles = 0;
+			auto tStart = std::chrono::steady_clock::now();
+			nOps = b.fnRun(nReps, nCycles);
+			fSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+			if (fSeconds >= fMinTime)
+				break;
+
+			// jump close to the minimum time once the estimate is reliable
+			if (fSeconds > 0.01)
+				nReps = (uint64_t)(nReps * fMinTime * 1.1 / fSeconds) + 1;
+			else
+				nReps *= 2;
+		}
+
+		char sLine[128];
+		if (nCycles > 0)
+			snprintf(sLine, sizeof(sLine), "%.3f\t%.2f", fSeconds * 1e9 / nOps, nCycles / fSeconds / 1e6);
+		else
+			snprintf(sLine, sizeof(sLine), "%.3f\t-", fSeconds * 1e9 / nOps);
+
+		std::cout << b.sName << "\t" << nOps << "\t" << sLine << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,366 @@
+#include "Apple1Cffa1.h"
+#include "Bus.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+Apple1Cffa1::Apple1Cffa1(const Apple1Config& config)
+{
+	sDirectory = config.sCffa1Dir;
+	vBuffer.assign(nBufferEnd - nBufferStart + 1, 0x00);
+	nCatalogPos = 0;
+}
+
+Apple1Cffa1::~Apple1Cffa1()
+{
+}
+
+uint8_t Apple1Cffa1::cpuRead(uint16_t addr)
+{
+	if (addr >= nBufferStart && addr <= nBufferEnd)
+		return vBuffer[addr - nBufferStart];
+
+	// card ID
+	if (addr == 0xAFDC)
+		return 0xCF;
+	if (addr == 0xAFDD)
+		return 0xFA;
+
+	// the firmware entries return right away, the calls run natively
+	if (addr == 0x9006 || addr == nApiEntry)
+		return 0x60;
+
+	return 0x00;
+}
+
+void Apple1Cffa1::cpuWrite(uint16_t addr, uint8_t data)
+{
+	if (addr >= nBufferStart && addr <= nBufferEnd)
+		vBuffer[addr - nBufferStart] = data;
+}
+
+bool Apple1Cffa1::IsApiEntry(uint16_t pc)
+{
+	return pc == nApiEntry;
+}
+
+void Apple1Cffa1::Call(Bus& bus)
+{
+	uint8_t nError = BadCall;
+
+	switch (bus.cpu->x)
+	{
+	case 0x00: nError = Version(bus); break;
+	case 0x10: nError = OpenDir(bus); break;
+	case 0x12: nError = ReadDir(bus); break;
+	case 0x20: nError = WriteFile(bus); break;
+	case 0x22: nError = ReadFile(bus); break;
+	case 0x24: nError = SaveBasicFile(bus); break;
+	case 0x26: nError = LoadBasicFile(bus); break;
+	case 0x28: nError = Rename(bus); break;
+	case 0x2A: nError = Delete(bus); break;
+	}
+
+	if (nError == NoError)
+		bus.cpu->status &= ~olc6502::C;
+	else
+	{
+		bus.cpu->a = nError;
+		bus.cpu->status |= olc6502::C;
+	}
+}
+
+uint8_t Apple1Cffa1::Version(Bus& bus)
+{
+	bus.cpu->a = 0x01;
+	return NoError;
+}
+
+uint8_t Apple1Cffa1::OpenDir(Bus&)
+{
+	vCatalog.clear();
+	nCatalogPos = 0;
+
+	std::error_code ec;
+	for (auto& entry : std::filesystem::directory_iterator(sDirectory, ec))
+	{
+		HostFile file;
+		if (entry.is_regular_file(ec) && ParseHostName(entry.path().filename().string(), file))
+			vCatalog.push_back(entry.path().filename().string());
+	}
+	if (ec)
+		return IoError;
+
+	std::sort(vCatalog.begin(), vCatalog.end());
+	return NoError;
+}
+
+uint8_t Apple1Cffa1::ReadDir(Bus& bus)
+{
+	if (nCatalogPos >= vCatalog.size())
+		return EndOfDirectory;
+
+	HostFile file;
+	ParseHostName(vCatalog[nCatalogPos++], file);
+
+	std::error_code ec;
+	uint32_t nSize = (uint32_t)std::filesystem::file_size(file.sPath, ec);
+	if (ec)
+		return IoError;
+
+	// ProDOS directory entry: storage type and name length, name, type, key block,
+	// blocks used, EOF, creation, versions, access, aux type, modification, header
+	uint8_t* e = vBuffer.data();
+	std::memset(e, 0, 39);
+	uint8_t nStorage = nSize <= 512 ? 1 : nSize <= 128 * 1024 ? 2 : 3;
+	e[0x00] = (uint8_t)((nStorage << 4) | file.sName.size());
+	std::memcpy(&e[0x01], file.sName.data(), file.sName.size());
+	e[0x10] = file.nType;
+	uint16_t nBlocks = (uint16_t)std::min<uint32_t>((nSize + 511) / 512 + (nStorage > 1 ? 1 : 0), 0xFFFF);
+	e[0x13] = nBlocks & 0xFF;
+	e[0x14] = nBlocks >> 8;
+	e[0x15] = nSize & 0xFF;
+	e[0x16] = (nSize >> 8) & 0xFF;
+	e[0x17] = (nSize >> 16) & 0xFF;
+	e[0x1E] = 0xE3;
+	e[0x1F] = file.nAux & 0xFF;
+	e[0x20] = file.nAux >> 8;
+
+	WriteWord(bus, 0x0B, nBufferStart);
+	return NoError;
+}
+
+uint8_t Apple1Cffa1::WriteFile(Bus& bus)
+{
+	std::string sName = ReadName(bus, 0x02);
+	if (!ValidName(sName))
+		return InvalidPath;
+
+	uint16_t nStart = ReadWord(bus, 0x00);
+	uint16_t nSize = ReadWord(bus, 0x09);
+	uint8_t nType = bus.cpuRead(0x06, true);
+	uint16_t nAux = ReadWord(bus, 0x07);
+
+	std::vector<uint8_t> vData(nSize);
+	for (uint32_t i = 0; i < nSize; i++)
+		vData[i] = bus.cpuRead((uint16_t)(nStart + i), true);
+
+	return Save(sName, nType, nAux, vData) ? NoError : IoError;
+}
+
+uint8_t Apple1Cffa1::ReadFile(Bus& bus)
+{
+	std::string sName = ReadName(bus, 0x02);
+	HostFile file;
+	if (!ValidName(sName))
+		return InvalidPath;
+	if (!Find(sName, file))
+		return FileNotFound;
+
+	uint8_t nType = bus.cpuRead(0x06, true);
+	if (nType != 0x00 && nType != file.nType)
+		return IncompatibleFormat;
+
+	std::vector<uint8_t> vData;
+	if (!Load(file, vData))
+		return IoError;
+
+	// Destination $0000 loads a binary where it was saved from
+	uint16_t nStart = ReadWord(bus, 0x00);
+	if (nStart == 0x0000)
+		nStart = file.nAux;
+
+	size_t nCopy = std::min<size_t>(vData.size(), 0x10000 - nStart);
+	std::copy(vData.begin(), vData.begin() + nCopy, bus.ram.begin() + nStart);
+
+	bus.cpuWrite(0x06, file.nType);
+	WriteWord(bus, 0x07, file.nAux);
+	WriteWord(bus, 0x09, (uint16_t)nCopy);
+	return NoError;
+}
+
+uint8_t Apple1Cffa1::SaveBasicFile(Bus& bus)
+{
+	std::string sName = ReadName(bus, 0x02);
+	if (!ValidName(sName))
+		return InvalidPath;
+
+	// BASIC's zero page ($4A LOMEM, $4C HIMEM, $CA PP ...) and the program up to HIMEM
+	uint16_t nHimem = ReadWord(bus, 0x4C);
+	uint16_t nProgram = ReadWord(bus, 0xCA);
+	if (nProgram > nHimem)
+		return IncompatibleFormat;
+
+	std::vector<uint8_t> vData(bus.ram.begin() + 0x4A, bus.ram.begin() + 0x100);
+	vData.insert(vData.end(), bus.ram.begin() + nProgram, bus.ram.begin() + nHimem);
+
+	return Save(sName, 0xF1, 0x0000, vData) ? NoError : IoError;
+}
+
+uint8_t Apple1Cffa1::LoadBasicFile(Bus& bus)
+{
+	std::string sName = ReadName(bus, 0x02);
+	HostFile file;
+	if (!ValidName(sName))
+		return InvalidPath;
+	if (!Find(sName, file))
+		return FileNotFound;
+	if (file.nType != 0xF1)
+		return IncompatibleFormat;
+
+	std::vector<uint8_t> vData;
+	if (!Load(file, vData))
+		return IoError;
+
+	const size_t nZeroPage = 0x100 - 0x4A;
+	if (vData.size() < nZeroPage)
+		return IncompatibleFormat;
+
+	uint16_t nProgram = vData[0xCA - 0x4A] | (vData[0xCB - 0x4A] << 8);
+	if (nProgram + (vData.size() - nZeroPage) > 0x10000)
+		return IncompatibleFormat;
+
+	std::copy(vData.begin(), vData.begin() + nZeroPage, bus.ram.begin() + 0x4A);
+	std::copy(vData.begin() + nZeroPage, vData.end(), bus.ram.begin() + nProgram);
+	return NoError;
+}
+
+uint8_t Apple1Cffa1::Rename(Bus& bus)
+{
+	std::string sOld = ReadName(bus, 0x04);
+	std::string sNew = ReadName(bus, 0x02);
+	HostFile file, existing;
+	if (!ValidName(sOld) || !ValidName(sNew))
+		return InvalidPath;
+	if (!Find(sOld, file))
+		return FileNotFound;
+	if (Find(sNew, existing))
+		return DuplicateName;
+
+	std::error_code ec;
+	std::filesystem::rename(file.sPath, (std::filesystem::path(sDirectory) / HostName(sNew, file.nType, file.nAux)), ec);
+	return ec ? IoError : NoError;
+}
+
+uint8_t Apple1Cffa1::Delete(Bus& bus)
+{
+	std::string sName = ReadName(bus, 0x02);
+	HostFile file;
+	if (!ValidName(sName))
+		return InvalidPath;
+	if (!Find(sName, file))
+		return FileNotFound;
+
+	std::error_code ec;
+	std::filesystem::remove(file.sPath, ec);
+	return ec ? IoError : NoError;
+}
+
+bool Apple1Cffa1::Find(const std::string& sName, HostFile& file)
+{
+	std::error_code ec;
+	for (auto& entry : std::filesystem::directory_iterator(sDirectory, ec))
+	{
+		if (entry.is_regular_file(ec) && ParseHostName(entry.path().filename().string(), file) && file.sName == sName)
+			return true;
+	}
+
+	return false;
+}
+
+bool Apple1Cffa1::ParseHostName(const std::string& sFileName, HostFile& file)
+{
+	file.sPath = (std::filesystem::path(sDirectory) / sFileName).string();
+	file.sName = sFileName;
+	file.nType = 0x06;
+	file.nAux = 0x0000;
+
+	// NAME#TTAAAA
+	size_t nHash = sFileName.rfind('#');
+	if (nHash != std::string::npos && sFileName.size() - nHash == 7)
+	{
+		try
+		{
+			uint32_t n = std::stoul(sFileName.substr(nHash + 1), nullptr, 16);
+			file.nType = (uint8_t)(n >> 16);
+			file.nAux = (uint16_t)n;
+			file.sName = sFileName.substr(0, nHash);
+		}
+		catch (...)
+		{
+		}
+	}
+
+	std::transform(file.sName.begin(), file.sName.end(), file.sName.begin(), ::toupper);
+	return ValidName(file.sName);
+}
+
+std::string Apple1Cffa1::HostName(const std::string& sName, uint8_t nType, uint16_t nAux)
+{
+	char sSuffix[8];
+	snprintf(sSuffix, sizeof(sSuffix), "#%02X%04X", nType, nAux);
+	return sName + sSuffix;
+}
+
+bool Apple1Cffa1::Save(const std::string& sName, uint8_t nType, uint16_t nAux, const std::vector<uint8_t>& vData)
+{
+	// a file of that name is replaced, also if its type differs
+	HostFile existing;
+	std::error_code ec;
+	if (Find(sName, existing))
+		std::filesystem::remove(existing.sPath, ec);
+
+	std::ofstream ofs(std::filesystem::path(sDirectory) / HostName(sName, nType, nAux), std::ofstream::binary | std::ofstream::trunc);
+	ofs.write((const char*)vData.data(), vData.size());
+	return ofs.good();
+}
+
+bool Apple1Cffa1::Load(const HostFile& file, std::vector<uint8_t>& vData)
+{
+	std::ifstream ifs(file.sPath, std::ifstream::binary);
+	if (!ifs.is_open())
+		return false;
+
+	vData.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	return true;
+}
+
+std::string Apple1Cffa1::ReadName(Bus& bus, uint16_t nPtrAddr)
+{
+	uint16_t nAddr = ReadWord(bus, nPtrAddr);
+	uint8_t nLength = bus.cpuRead(nAddr, true);
+
+	std::string sName;
+	for (uint8_t i = 1; i <= nLength; i++)
+		sName += (char)::toupper(bus.cpuRead((uint16_t)(nAddr + i), true) & 0x7F);
+	return sName;
+}
+
+bool Apple1Cffa1::ValidName(const std::string& sName)
+{
+	// ProDOS: up to 15 letters, digits and periods, starting with a letter
+	if (sName.empty() || sName.size() > 15 || !isalpha((uint8_t)sName[0]))
+		return false;
+
+	for (char c : sName)
+	{
+		if (!isalnum((uint8_t)c) && c != '.')
+			return false;
+	}
+	return true;
+}
+
+uint16_t Apple1Cffa1::ReadWord(Bus& bus, uint16_t nAddr)
+{
+	return bus.cpuRead(nAddr, true) | (bus.cpuRead((uint16_t)(nAddr + 1), true) << 8);
+}
+
+void Apple1Cffa1::WriteWord(Bus& bus, uint16_t nAddr, uint16_t nValue)
+{
+	bus.cpuWrite(nAddr, nValue & 0xFF);
+	bus.cpuWrite((uint16_t)(nAddr + 1), nValue >> 8);
+}
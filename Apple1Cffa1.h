@@ -0,0 +1,108 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Apple1Config.h"
+
+class Bus;
+
+/*
+CFFA1 compatible mass storage card, backed by a directory of the host instead
+of a CompactFlash card. The card occupies $9000-$AFFF; its ID bytes $CF $FA
+are at $AFDC/$AFDD, so programs find it the usual way.
+
+The firmware API is implemented natively: a program calls JSR $900C with the
+command in X and the parameters in the zero page, the call runs in the
+emulator when the CPU arrives at $900C and returns through an RTS there. The
+carry is set on error with the ProDOS error code in A. A load is one copy of
+the file into Bus::ram.
+
+	$00 Destination		load/save address
+	$02 Filename		pointer to a counted string, bit 7 of the characters ignored
+	$06 Filetype		ProDOS type, 0 on load = any
+	$07 Auxtype			ProDOS aux type, the load address of binaries
+	$09 FileSize
+	$0B EntryPtr		ReadDir: pointer to a 39 byte ProDOS directory entry
+
+	X = $00 Version		$10 OpenDir		$12 ReadDir (carry set after the last entry)
+		$20 WriteFile	$22 ReadFile	$24 SaveBASICFile	$26 LoadBASICFile
+		$28 Rename (Filename to OldFilename at $04)		$2A Delete
+
+Host files are named like CiderPress exports, NAME#TTAAAA with the ProDOS file
+type and aux type in hex, so both survive on the host; a file without the suffix
+is a binary ($06) for $0000. BASIC files ($F1) hold $004A-$00FF and the
+program from PP to HIMEM, as BASIC programs are saved to tape.
+*/
+
+class Apple1Cffa1
+{
+public:
+	Apple1Cffa1(const Apple1Config& config);
+	~Apple1Cffa1();
+
+public:
+	// $9000-$AFFF
+	uint8_t cpuRead(uint16_t addr);
+	void cpuWrite(uint16_t addr, uint8_t data);
+
+	// the CPU is at the API entry
+	bool IsApiEntry(uint16_t pc);
+	void Call(Bus& bus);
+
+	const static uint16_t nApiEntry = 0x900C;
+
+private:
+	std::string sDirectory;
+
+	// $AE00-$AFDB is RAM of the card, ReadDir puts its entry there
+	std::vector<uint8_t> vBuffer;
+	const static uint16_t nBufferStart = 0xAE00;
+	const static uint16_t nBufferEnd = 0xAFDB;
+
+	// OpenDir takes a sorted snapshot of the directory
+	std::vector<std::string> vCatalog;
+	size_t nCatalogPos;
+
+	struct HostFile
+	{
+		std::string sPath;
+		std::string sName;		// ProDOS name, upper case
+		uint8_t nType = 0x06;
+		uint16_t nAux = 0x0000;
+	};
+
+	uint8_t Version(Bus& bus);
+	uint8_t OpenDir(Bus& bus);
+	uint8_t ReadDir(Bus& bus);
+	uint8_t WriteFile(Bus& bus);
+	uint8_t ReadFile(Bus& bus);
+	uint8_t SaveBasicFile(Bus& bus);
+	uint8_t LoadBasicFile(Bus& bus);
+	uint8_t Rename(Bus& bus);
+	uint8_t Delete(Bus& bus);
+
+	bool Find(const std::string& sName, HostFile& file);
+	bool ParseHostName(const std::string& sFileName, HostFile& file);
+	std::string HostName(const std::string& sName, uint8_t nType, uint16_t nAux);
+	bool Save(const std::string& sName, uint8_t nType, uint16_t nAux, const std::vector<uint8_t>& vData);
+	bool Load(const HostFile& file, std::vector<uint8_t>& vData);
+
+	static std::string ReadName(Bus& bus, uint16_t nPtrAddr);
+	static bool ValidName(const std::string& sName);
+	static uint16_t ReadWord(Bus& bus, uint16_t nAddr);
+	static void WriteWord(Bus& bus, uint16_t nAddr, uint16_t nValue);
+
+	// ProDOS error codes
+	enum Error : uint8_t
+	{
+		NoError = 0x00,
+		BadCall = 0x01,
+		IoError = 0x27,
+		InvalidPath = 0x40,
+		FileNotFound = 0x46,
+		DuplicateName = 0x47,
+		IncompatibleFormat = 0x4A,
+		EndOfDirectory = 0x4C
+	};
+};
@@ -0,0 +1,503 @@
+#include "Apple1Config.h"
+#include "Apple1Roms.h"
+#include "ParseNumber.h"
+#include "WavFile.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+Apple1Config::Apple1Config()
+{
+	vRoms.push_back({ "builtin:monitor", 0xFF00, Apple1Roms::HexMonitor.data(), Apple1Roms::HexMonitor.size() });
+	vRoms.push_back({ "builtin:basic", 0xE000, Apple1Roms::Basic.data(), Apple1Roms::Basic.size() });
+	bDefaultRoms = true;
+	sCharmap = "";
+	nResetVector = 0xFF00;
+	nRamSize = 64 * 1024;
+	nOpenBus = 0x00;
+	bOpenBusHigh = false;
+	bPia = true;
+	sAciRom = "";
+	sTapeFile = "";
+	sRecordFile = "";
+	bInstantLoad = true;
+	sCffa1Dir = "";
+	nSerialBase = 0x0000;
+	nCpu = Cpu::NMOS6502;
+	nRefresh = Refresh::Batch;
+
+	nFrontend = Frontend::Window;
+	nSpeed = Speed::Frame;
+	nClockHz = 1022727;
+	bDebugScreen = false;
+	bStatusPanel = true;
+	bCodePanel = true;
+	bPerfPanel = true;
+}
+
+Apple1Config::~Apple1Config()
+{
+}
+
+bool Apple1Config::ParseArgs(const std::vector<std::string>& vArgs, std::vector<std::string>& vRest, std::string& sError)
+{
+	static const char* sKeys[] = { "rom", "image", "reset", "charmap", "ram", "map", "openbus", "pia", "aci", "tape", "record", "tapeload", "cffa1", "serial", "cpu", "refresh", "speed", "mode", "debug", "panels" };
+
+	for (size_t i = 0; i < vArgs.size(); i++)
+	{
+		const std::string& a = vArgs[i];
+
+		if (a == "--console")
+			nFrontend = Frontend::Console;
+		else if (a == "--batch")
+			nFrontend = Frontend::Batch;
+		else if (a == "--debug")
+			bDebugScreen = true;
+		else if (a == "--testrom")
+			SetTestRom();
+		else if (a == "--config" && i + 1 < vArgs.size())
+		{
+			if (!ReadFile(vArgs[++i], sError))
+				return false;
+		}
+		else
+		{
+			bool bOption = false;
+			for (auto k : sKeys)
+			{
+				if (a.size() > 2 && a.compare(0, 2, "--") == 0 && a.compare(2, std::string::npos, k) == 0)
+				{
+					if (i + 1 == vArgs.size())
+					{
+						sError = a + " needs a value";
+						return false;
+					}
+					if (!Set(k, vArgs[++i], sError))
+						return false;
+					bOption = true;
+					break;
+				}
+			}
+
+			if (!bOption)
+				vRest.push_back(a);
+		}
+	}
+
+	return true;
+}
+
+bool Apple1Config::ReadFile(const std::string& sFileName, std::string& sError)
+{
+	std::ifstream ifs(sFileName);
+	if (!ifs.is_open())
+	{
+		sError = "cannot open config " + sFileName;
+		return false;
+	}
+
+	std::string sLine;
+	size_t nLine = 0;
+	while (std::getline(ifs, sLine))
+	{
+		nLine++;
+
+		size_t nComment = sLine.find('#');
+		if (nComment != std::string::npos)
+			sLine.erase(nComment);
+
+		size_t nEquals = sLine.find('=');
+		if (nEquals == std::string::npos)
+		{
+			if (sLine.find_first_not_of(" \t\r") == std::string::npos)
+				continue;
+
+			sError = sFileName + ":" + std::to_string(nLine) + ": expected key = value";
+			return false;
+		}
+
+		auto Trim = [](const std::string& s)
+		{
+			size_t b = s.find_first_not_of(" \t\r");
+			size_t e = s.find_last_not_of(" \t\r");
+			return b == std::string::npos ? std::string() : s.substr(b, e - b + 1);
+		};
+
+		if (!Set(Trim(sLine.substr(0, nEquals)), Trim(sLine.substr(nEquals + 1)), sError))
+		{
+			sError = sFileName + ":" + std::to_string(nLine) + ": " + sError;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool Apple1Config::Set(const std::string& sKey, const std::string& sValue, std::string& sError)
+{
+	if (sKey == "rom")
+	{
+		// explicitly given ROMs replace the default set
+		if (bDefaultRoms)
+		{
+			vRoms.clear();
+			bDefaultRoms = false;
+		}
+
+		if (sValue == "none")
+		{
+			vRoms.clear();
+			return true;
+		}
+
+		MemoryImage image;
+		if (!ParseImage(sValue, image))
+		{
+			sError = "rom expects file@addr, got " + sValue;
+			return false;
+		}
+		if (!image.pBuiltin && !FileExists(image.sFileName))
+		{
+			sError = "cannot open rom " + image.sFileName;
+			return false;
+		}
+		vRoms.push_back(image);
+	}
+	else if (sKey == "image")
+	{
+		MemoryImage image;
+		if (!ParseImage(sValue, image))
+		{
+			sError = "image expects file@addr, got " + sValue;
+			return false;
+		}
+		if (!image.pBuiltin && !FileExists(image.sFileName))
+		{
+			sError = "cannot open image " + image.sFileName;
+			return false;
+		}
+		vImages.push_back(image);
+	}
+	else if (sKey == "reset")
+	{
+		if (!ParseAddress(sValue, nResetVector))
+		{
+			sError = "reset expects a hex address up to FFFF, got " + sValue;
+			return false;
+		}
+	}
+	else if (sKey == "charmap")
+	{
+		if (!FileExists(sValue))
+		{
+			sError = "cannot open charmap " + sValue;
+			return false;
+		}
+		sCharmap = sValue;
+	}
+	else if (sKey == "ram")
+	{
+		// decimal bytes, or kilobytes with a K suffix
+		uint64_t nSize = 0;
+		bool bKilo = !sValue.empty() && (sValue.back() == 'K' || sValue.back() == 'k');
+		if (!ParseNumber(bKilo ? sValue.substr(0, sValue.size() - 1) : sValue, nSize, 10, 64 * 1024))
+			nSize = 0;
+		if (bKilo)
+			nSize *= 1024;
+
+		if (nSize == 0 || nSize > 64 * 1024)
+		{
+			sError = "ram expects a size up to 64K, got " + sValue;
+			return false;
+		}
+		nRamSize = (uint32_t)nSize;
+	}
+	else if (sKey == "map")
+	{
+		MemoryRegion region;
+		if (!ParseRegion(sValue, region))
+		{
+			sError = "map expects ram|rom|open start-end or mirror start-end start-end, got " + sValue;
+			return false;
+		}
+		vMap.push_back(region);
+	}
+	else if (sKey == "openbus")
+	{
+		uint64_t nValue = 0;
+		if (sValue == "high")
+			bOpenBusHigh = true;
+		else
+		{
+			if (!ParseNumber(sValue, nValue, 16, 0xFF))
+			{
+				sError = "openbus expects a hex byte or high, got " + sValue;
+				return false;
+			}
+			nOpenBus = (uint8_t)nValue;
+			bOpenBusHigh = false;
+		}
+	}
+	else if (sKey == "pia")
+	{
+		if (!ParseSwitch(sValue, bPia))
+		{
+			sError = "pia expects on or off, got " + sValue;
+			return false;
+		}
+	}
+	else if (sKey == "aci")
+	{
+		if (!FileExists(sValue))
+		{
+			sError = "cannot open aci rom " + sValue;
+			return false;
+		}
+		sAciRom = sValue;
+	}
+	else if (sKey == "tape")
+	{
+		WavReader wav;
+		if (!wav.Open(sValue, sError))
+			return false;
+		sTapeFile = sValue;
+	}
+	else if (sKey == "record")
+	{
+		sRecordFile = sValue;
+	}
+	else if (sKey == "tapeload")
+	{
+		if (sValue == "instant")
+			bInstantLoad = true;
+		else if (sValue == "real")
+			bInstantLoad = false;
+		else
+		{
+			sError = "tapeload expects instant or real, got " + sValue;
+			return false;
+		}
+	}
+	else if (sKey == "cffa1")
+	{
+		std::error_code ec;
+		if (!std::filesystem::is_directory(sValue, ec))
+		{
+			sError = "cffa1 expects a directory, got " + sValue;
+			return false;
+		}
+		sCffa1Dir = sValue;
+	}
+	else if (sKey == "serial")
+	{
+		uint16_t nBase = 0;
+		if (sValue != "off")
+		{
+			if (!ParseAddress(sValue, nBase) || nBase == 0 || nBase > 0xFFF0)
+			{
+				sError = "serial expects a hex address or off, got " + sValue;
+				return false;
+			}
+		}
+		nSerialBase = nBase;
+	}
+	else if (sKey == "cpu")
+	{
+		// olc6502 implements the NMOS 6502 only
+		if (sValue != "6502")
+		{
+			sError = "unsupported cpu " + sValue + ", only 6502 is emulated";
+			return false;
+		}
+		nCpu = Cpu::NMOS6502;
+	}
+	else if (sKey == "refresh")
+	{
+		if (sValue == "off")
+			nRefresh = Refresh::Off;
+		else if (sValue == "batch")
+			nRefresh = Refresh::Batch;
+		else if (sValue == "exact")
+			nRefresh = Refresh::Exact;
+		else
+		{
+			sError = "refresh expects off, batch or exact, got " + sValue;
+			return false;
+		}
+	}
+	else if (sKey == "speed")
+	{
+		if (sValue == "frame")
+			nSpeed = Speed::Frame;
+		else if (sValue == "max")
+			nSpeed = Speed::Unlimited;
+		else if (sValue == "warp")
+			nSpeed = Speed::Warp;
+		else
+		{
+			uint64_t nHz = 0;
+			if (!ParseNumber(sValue, nHz, 10, UINT32_MAX) || nHz == 0)
+			{
+				sError = "speed expects frame, max, warp or a clock in Hz, got " + sValue;
+				return false;
+			}
+			nClockHz = (uint32_t)nHz;
+			nSpeed = Speed::Clock;
+		}
+	}
+	else if (sKey == "mode")
+	{
+		if (sValue == "window")
+			nFrontend = Frontend::Window;
+		else if (sValue == "console")
+			nFrontend = Frontend::Console;
+		else if (sValue == "batch")
+			nFrontend = Frontend::Batch;
+		else
+		{
+			sError = "mode expects window, console or batch, got " + sValue;
+			return false;
+		}
+	}
+	else if (sKey == "debug")
+	{
+		if (!ParseSwitch(sValue, bDebugScreen))
+		{
+			sError = "debug expects on or off, got " + sValue;
+			return false;
+		}
+	}
+	else if (sKey == "panels")
+	{
+		bStatusPanel = false;
+		bCodePanel = false;
+		bPerfPanel = false;
+
+		std::stringstream ss(sValue);
+		std::string sPanel;
+		while (std::getline(ss, sPanel, ','))
+		{
+			if (sPanel == "status")
+				bStatusPanel = true;
+			else if (sPanel == "code")
+				bCodePanel = true;
+			else if (sPanel == "perf")
+				bPerfPanel = true;
+			else if (sPanel != "none")
+			{
+				sError = "unknown panel " + sPanel;
+				return false;
+			}
+		}
+	}
+	else
+	{
+		sError = "unknown option " + sKey;
+		return false;
+	}
+
+	return true;
+}
+
+void Apple1Config::SetTestRom()
+{
+	vRoms.clear();
+	bDefaultRoms = false;
+	vImages.clear();
+	vImages.push_back({ "6502_functional_test.bin", 0x0000 });
+	nResetVector = 0x0400;
+	bPia = false;
+}
+
+const char* Apple1Config::Usage()
+{
+	return "[--config file] [--rom file@addr ...] [--image file@addr ...] [--reset addr] [--charmap file] [--ram size] "
+		"[--map 'kind range' ...] [--openbus xx|high] [--pia on|off] [--aci file] [--tape file.wav] [--record file.wav] [--tapeload instant|real] [--cffa1 dir] [--serial addr|off] "
+		"[--cpu 6502] [--refresh off|batch|exact] [--speed frame|max|warp|hz] [--mode window|console|batch] [--debug] [--panels status,code,perf] [--testrom]";
+}
+
+bool Apple1Config::ParseImage(const std::string& sValue, MemoryImage& image)
+{
+	size_t nAt = sValue.rfind('@');
+	if (nAt == std::string::npos || nAt == 0)
+		return false;
+
+	if (!ParseAddress(sValue.substr(nAt + 1), image.nOffset))
+		return false;
+
+	image.sFileName = sValue.substr(0, nAt);
+
+	if (image.sFileName == "builtin:monitor")
+	{
+		image.pBuiltin = Apple1Roms::HexMonitor.data();
+		image.nBuiltinSize = Apple1Roms::HexMonitor.size();
+	}
+	else if (image.sFileName == "builtin:basic")
+	{
+		image.pBuiltin = Apple1Roms::Basic.data();
+		image.nBuiltinSize = Apple1Roms::Basic.size();
+	}
+
+	return true;
+}
+
+bool Apple1Config::FileExists(const std::string& sFileName)
+{
+	std::ifstream ifs(sFileName, std::ifstream::binary);
+	return ifs.is_open();
+}
+
+bool Apple1Config::ParseRange(const std::string& sValue, uint16_t& nStart, uint16_t& nEnd)
+{
+	size_t nDash = sValue.find('-');
+	if (nDash == std::string::npos)
+		return false;
+
+	uint16_t nLow = 0;
+	uint16_t nHigh = 0;
+	if (!ParseAddress(sValue.substr(0, nDash), nLow) || !ParseAddress(sValue.substr(nDash + 1), nHigh) || nLow > nHigh)
+		return false;
+
+	nStart = nLow;
+	nEnd = nHigh;
+	return true;
+}
+
+bool Apple1Config::ParseRegion(const std::string& sValue, MemoryRegion& region)
+{
+	std::stringstream ss(sValue);
+	std::string sKind, sRange, sSource, sExtra;
+	ss >> sKind >> sRange >> sSource >> sExtra;
+
+	if (sKind == "ram")
+		region.nKind = MemoryRegion::Kind::Ram;
+	else if (sKind == "rom")
+		region.nKind = MemoryRegion::Kind::ReadOnly;
+	else if (sKind == "open")
+		region.nKind = MemoryRegion::Kind::Open;
+	else if (sKind == "mirror")
+		region.nKind = MemoryRegion::Kind::Mirror;
+	else
+		return false;
+
+	if (!ParseRange(sRange, region.nStart, region.nEnd) || !sExtra.empty())
+		return false;
+
+	if (region.nKind == MemoryRegion::Kind::Mirror)
+		return ParseRange(sSource, region.nSourceStart, region.nSourceEnd);
+
+	return sSource.empty();
+}
+
+bool Apple1Config::ParseSwitch(const std::string& sValue, bool& bSwitch)
+{
+	if (sValue == "on" || sValue == "1" || sValue == "true")
+		bSwitch = true;
+	else if (sValue == "off" || sValue == "0" || sValue == "false")
+		bSwitch = false;
+	else
+		return false;
+
+	return true;
+}
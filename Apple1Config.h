@@ -0,0 +1,155 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+Runtime configuration of machine and frontend, from the command line and/or a
+config file. Every option exists in both forms, "--key value" on the command
+line and "key = value" in the file (one per line, '#' starts a comment):
+
+	rom = file@addr			ROM image mapped at hex address, repeatable - the first one
+							replaces the default monitor + BASIC ROMs, "none" maps no ROM,
+							builtin:monitor and builtin:basic are the embedded images
+	image = file@addr		image copied into RAM at power on, repeatable
+	reset = addr			reset vector stored at $FFFC (seen if no ROM covers it)
+	charmap = file			character generator ROM of the terminal, default embedded
+	ram = size				populated RAM from $0000, e.g. 4K, 8K, 0x8000 or 65536
+	map = kind range		memory map region laid over ram, repeatable, applied in order:
+							ram 1000-8FFF (RAM), rom E000-EFFF (read only, e.g. an image),
+							open 2000-2FFF (unmapped), mirror D000-D0FF D010-D01F (the
+							second range repeated in the first, devices included)
+	openbus = xx|high		value read where nothing is mapped, hex, or high for the high
+							byte of the address (the operand byte an NMOS 6502 fetched last)
+	pia = on|off			keyboard/display PIA at $D010, decoded like the board: its registers
+							repeat wherever A4 is set in $D000-$DFFF
+	aci = file				Apple Cassette Interface card with this 256 byte ROM image at
+							$C100, tape I/O at $C000-$C0FF
+	tape = file.wav			cassette played into the ACI
+	record = file.wav		ACI output recorded to this file
+	cffa1 = dir				CFFA1 storage card at $9000, its files in this host directory
+	serial = addr|off		6551 ACIA serial card at this hex address, connected to a pty
+	tapeload = mode			instant (default, the read routine copies the tape straight
+							to RAM) or real (read in real time like the real card)
+	cpu = 6502				CPU variant
+	refresh = mode			DRAM refresh stretching of the CPU clock: batch (default, derived
+							from the cycle count), exact (per cycle, in phase with the scan
+							line) or off (CPU runs at the full clock)
+	speed = mode			window: frame (one instruction per frame), max (unthrottled), warp
+							(unthrottled except while waiting for a key) or a clock in Hz
+	mode = window|console|batch
+	debug = on|off			window: debug screen with panels next to the terminal
+	panels = list			window: debug panels shown initially - status,code,perf
+
+Command line only: --config file, and the shorthands --console, --batch,
+--debug and --testrom (Klaus Dormann's 6502 functional test in RAM, no ROMs,
+no PIA, reset to $0400).
+*/
+
+struct MemoryImage
+{
+	std::string sFileName;
+	uint16_t nOffset = 0x0000;
+	const uint8_t* pBuiltin = nullptr;	// embedded image (see Apple1Roms) instead of the file
+	size_t nBuiltinSize = 0;
+};
+
+// declared memory region, see Bus::BuildMap
+struct MemoryRegion
+{
+	enum class Kind : uint8_t
+	{
+		Ram,
+		ReadOnly,	// RAM contents, writes ignored
+		Open,
+		Mirror
+	};
+
+	Kind nKind = Kind::Ram;
+	uint16_t nStart = 0x0000;
+	uint16_t nEnd = 0x0000;
+	uint16_t nSourceStart = 0x0000;		// mirror: repeated throughout nStart-nEnd
+	uint16_t nSourceEnd = 0x0000;
+};
+
+class Apple1Config
+{
+public:
+	Apple1Config();
+	~Apple1Config();
+
+	enum class Frontend : uint8_t
+	{
+		Window,
+		Console,
+		Batch
+	};
+
+	enum class Speed : uint8_t
+	{
+		Frame,		// one instruction per frame, for watching the debug panels
+		Unlimited,	// as fast as the host allows
+		Clock,		// nClockHz
+		Warp		// unlimited while the program runs, nClockHz while it waits for a key
+	};
+
+	enum class Cpu : uint8_t
+	{
+		NMOS6502
+	};
+
+	enum class Refresh : uint8_t
+	{
+		Off,
+		Batch,
+		Exact
+	};
+
+public: // machine
+	std::vector<MemoryImage> vRoms;
+	std::vector<MemoryImage> vImages;
+	std::string sCharmap;		// empty = embedded
+	uint16_t nResetVector;
+	uint32_t nRamSize;
+	std::vector<MemoryRegion> vMap;
+	uint8_t nOpenBus;
+	bool bOpenBusHigh;
+	bool bPia;
+	std::string sAciRom;		// empty = no ACI
+	std::string sTapeFile;
+	std::string sRecordFile;
+	bool bInstantLoad;
+	std::string sCffa1Dir;		// empty = no CFFA1
+	uint16_t nSerialBase;		// 0 = no serial card
+	Cpu nCpu;
+	Refresh nRefresh;
+
+public: // frontend
+	Frontend nFrontend;
+	Speed nSpeed;
+	uint32_t nClockHz;
+	bool bDebugScreen;
+	bool bStatusPanel;
+	bool bCodePanel;
+	bool bPerfPanel;
+
+public:
+	// consumes the configuration options of vArgs, the others are left in vRest in order
+	bool ParseArgs(const std::vector<std::string>& vArgs, std::vector<std::string>& vRest, std::string& sError);
+	bool ReadFile(const std::string& sFileName, std::string& sError);
+	bool Set(const std::string& sKey, const std::string& sValue, std::string& sError);
+
+	void SetTestRom();
+
+	// option summary for usage messages
+	static const char* Usage();
+
+private:
+	bool bDefaultRoms;
+
+	static bool ParseImage(const std::string& sValue, MemoryImage& image);
+	static bool ParseSwitch(const std::string& sValue, bool& bSwitch);
+	static bool ParseRange(const std::string& sValue, uint16_t& nStart, uint16_t& nEnd);
+	static bool ParseRegion(const std::string& sValue, MemoryRegion& region);
+	static bool FileExists(const std::string& sFileName);
+};
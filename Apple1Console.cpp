@@ -0,0 +1,199 @@
+#include "Apple1Console.h"
+#include "Apple1TerminalStream.h"
+#include "IntegerBasic.h"
+#include "ParseNumber.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+Apple1Console::Apple1Console(const Apple1Config& config) :
+	machine{ config }
+{
+	bRunOverride = false;
+	nRunAddress = 0x0000;
+
+	if (machine.bus->acia)
+	{
+		serial = std::make_shared<PtyBridge>(machine.bus->acia);
+		std::string sError;
+		if (serial->Open(sError))
+			std::cerr << "serial card connected to " << serial->getName() << std::endl;
+		else
+		{
+			std::cerr << sError << std::endl;
+			serial.reset();
+		}
+	}
+}
+
+Apple1Console::~Apple1Console()
+{
+}
+
+Apple1Machine::ExitReason Apple1Console::Run(std::istream& is, std::ostream& os, uint64_t nCycleBudget)
+{
+	machine.term->setSink(std::make_shared<Apple1TerminalStream>(os));
+	machine.Reset();
+
+	if (!sLoadFile.empty())
+	{
+		LoadResult result = machine.Load(sLoadFile);
+		if (!result.bValid)
+			std::cerr << "cannot load " << sLoadFile << (result.sError.empty() ? "" : ": " + result.sError) << std::endl;
+	}
+	if (bRunOverride)
+		machine.RunAt(nRunAddress);
+
+	bool bInputEof = false;
+
+	while (true)
+	{
+		uint64_t nRun = nSlice;
+		if (nCycleBudget > 0)
+		{
+			if (machine.getCycles() >= nCycleBudget)
+				return Apple1Machine::ExitReason::CycleBudget;
+			nRun = std::min(nSlice, nCycleBudget - machine.getCycles());
+		}
+
+		auto r = machine.Run(nRun);
+
+		if (r == Apple1Machine::ExitReason::Halted)
+		{
+			os.flush();
+			return r;
+		}
+
+		if (r == Apple1Machine::ExitReason::InputDrained)
+		{
+			// program waits for a key - hand over to the user
+			os.flush();
+
+			// it may wait for the serial line as well
+			if (serial && WaitForSerial(is, bInputEof))
+				continue;
+
+			std::string sLine;
+			if (!std::getline(is, sLine))
+			{
+				// give a connected host the chance to finish before giving up
+				if (serial && !bInputEof)
+				{
+					bInputEof = true;
+					continue;
+				}
+				return r;
+			}
+
+			machine.TypeText(sLine + "\n");
+		}
+	}
+}
+
+bool Apple1Console::WaitForSerial(std::istream& is, bool bInputEof)
+{
+#ifndef _WIN32
+	auto tLinger = std::chrono::steady_clock::now() + std::chrono::milliseconds(nSerialLingerMs);
+
+	while (!machine.bus->acia->ReceivePending())
+	{
+		if (bInputEof)
+		{
+			if (std::chrono::steady_clock::now() >= tLinger)
+				return false;
+			usleep(nSerialPollMs * 1000);
+			continue;
+		}
+
+		// a line buffered by the stream or waiting on stdin (or stdin at its end)
+		if (is.rdbuf()->in_avail() > 0)
+			return false;
+		pollfd fd = { STDIN_FILENO, POLLIN, 0 };
+		if (poll(&fd, 1, nSerialPollMs) != 0)
+			return false;
+	}
+
+	return true;
+#else
+	(void)is;
+	(void)bInputEof;
+	return false;
+#endif
+}
+
+void Apple1Console::setKeyDelay(uint32_t nCycles)
+{
+	machine.kbd->setKeyDelay(nCycles);
+}
+
+void Apple1Console::setLoadFile(const std::string& sSpec)
+{
+	sLoadFile = sSpec;
+}
+
+void Apple1Console::setRunAddress(uint16_t nAddr)
+{
+	bRunOverride = true;
+	nRunAddress = nAddr;
+}
+
+void Apple1Console::setSaveFile(const std::string& sFileName)
+{
+	sSaveFile = sFileName;
+}
+
+int Apple1Console::Main(const std::vector<std::string>& vArgs, const Apple1Config& config)
+{
+	uint64_t nCycleBudget = 0;
+	uint32_t nKeyDelay = 0;
+	Apple1Console console(config);
+
+	for (size_t i = 0; i < vArgs.size(); i++)
+	{
+		uint64_t n = 0;
+		uint16_t nAddr = 0x0000;
+		bool bValid = true;
+
+		if (vArgs[i] == "-c" && i + 1 < vArgs.size())
+			bValid = ParseNumber(vArgs[++i], nCycleBudget);
+		else if (vArgs[i] == "-k" && i + 1 < vArgs.size())
+		{
+			bValid = ParseNumber(vArgs[++i], n, 10, UINT32_MAX);
+			nKeyDelay = (uint32_t)n;
+		}
+		else if (vArgs[i] == "-l" && i + 1 < vArgs.size())
+			console.setLoadFile(vArgs[++i]);
+		else if (vArgs[i] == "-r" && i + 1 < vArgs.size())
+		{
+			bValid = ParseAddress(vArgs[++i], nAddr);
+			console.setRunAddress(nAddr);
+		}
+		else if (vArgs[i] == "-s" && i + 1 < vArgs.size())
+			console.setSaveFile(vArgs[++i]);
+		else
+			bValid = false;
+
+		if (!bValid)
+		{
+			std::cerr << "usage: --console [-c cycles] [-k keydelay] [-l file[@addr]] [-r addr] [-s file.bas]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::ios::sync_with_stdio(false);
+
+	console.setKeyDelay(nKeyDelay);
+	auto r = console.Run(std::cin, std::cout, nCycleBudget);
+	std::cout << std::endl;
+
+	if (!console.sSaveFile.empty() && !IntegerBasic::SaveFile(*console.machine.bus, console.sSaveFile))
+		std::cerr << "cannot save " << console.sSaveFile << std::endl;
+
+	return r == Apple1Machine::ExitReason::CycleBudget ? 2 : 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Apple1Machine.h"
+#include "PtyBridge.h"
+
+/*
+Headless console frontend: terminal output goes to a stream (stdout), keyboard
+input is read line by line from a stream (stdin) whenever the running program
+waits for a key. The machine runs unthrottled. A serial card is connected to a
+host pty; while the program waits, data from the pty keeps it running as well
+as a line on stdin, and after the end of stdin the host gets a moment to finish.
+*/
+
+class Apple1Console
+{
+public:
+	Apple1Console(const Apple1Config& config = Apple1Config());
+	~Apple1Console();
+
+	// returns when input is exhausted, the CPU halted or the cycle budget is used up (0 = unlimited)
+	Apple1Machine::ExitReason Run(std::istream& is, std::ostream& os, uint64_t nCycleBudget = 0);
+	void setKeyDelay(uint32_t nCycles);
+	void setLoadFile(const std::string& sSpec);
+	void setRunAddress(uint16_t nAddr);
+	void setSaveFile(const std::string& sFileName);
+
+	// command line entry: [-c cycles] [-k keydelay] [-l file[@addr]] [-r addr] [-s file.bas]
+	static int Main(const std::vector<std::string>& vArgs, const Apple1Config& config = Apple1Config());
+
+private:
+	Apple1Machine machine;
+	std::shared_ptr<PtyBridge> serial;		// host side of the serial card, if any
+	std::string sLoadFile;
+	bool bRunOverride;
+	uint16_t nRunAddress;
+	std::string sSaveFile;		// BASIC program is listed into it at the end
+
+	const static uint64_t nSlice = 1000000;
+	const static int nSerialPollMs = 10;
+	const static int nSerialLingerMs = 1000;
+
+	// true when serial input arrived before stdin had a line (or, after its end, within nSerialLingerMs)
+	bool WaitForSerial(std::istream& is, bool bInputEof);
+};
@@ -0,0 +1,297 @@
+#include "Apple1EmulationThread.h"
+
+#include <future>
+
+Apple1EmulationThread::Apple1EmulationThread(std::shared_ptr<Apple1Machine> machine, const Apple1Config& config) :
+	machine{ machine }
+{
+	nSpeed = config.nSpeed;
+	nClockHz = config.nClockHz;
+	bWarping = false;
+
+	bStop = false;
+	bWake = false;
+	bRunning = true;
+	nStepRequests = 0;
+	nDroppedKeys = 0;
+	nInstructions = 0;
+	nBusyNanos = 0;
+	nLastKeyCycle = 0;
+
+	// serial input wakes the thread like a key
+	if (machine->bus->acia)
+		machine->bus->acia->setReceiveHandler([this]() { Wake(); });
+}
+
+Apple1EmulationThread::~Apple1EmulationThread()
+{
+	Stop();
+	if (machine->bus->acia)
+		machine->bus->acia->setReceiveHandler(nullptr);
+}
+
+void Apple1EmulationThread::Start()
+{
+	if (thread.joinable())
+		return;
+
+	bStop = false;
+	Publish();
+	thread = std::thread(&Apple1EmulationThread::ThreadLoop, this);
+}
+
+void Apple1EmulationThread::Stop()
+{
+	if (!thread.joinable())
+		return;
+
+	bStop = true;
+	Wake();
+	thread.join();
+
+	// commands queued while stopping still run, nobody waits forever
+	RunCommands();
+}
+
+void Apple1EmulationThread::Execute(const std::function<void()>& fn)
+{
+	if (!thread.joinable())
+	{
+		fn();
+		Publish();
+		return;
+	}
+
+	std::promise<void> done;
+	auto future = done.get_future();
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		vCommands.push_back([&]() {
+			fn();
+			done.set_value();
+		});
+	}
+	Wake();
+
+	future.wait();
+}
+
+bool Apple1EmulationThread::PushKey(uint8_t key)
+{
+	if (!keyRing.Push(key))
+	{
+		nDroppedKeys++;
+		return false;
+	}
+
+	Wake();
+	return true;
+}
+
+void Apple1EmulationThread::setRunning(bool bRunning)
+{
+	this->bRunning = bRunning;
+	Wake();
+}
+
+bool Apple1EmulationThread::isRunning()
+{
+	return bRunning;
+}
+
+void Apple1EmulationThread::Step()
+{
+	nStepRequests++;
+	Wake();
+}
+
+void Apple1EmulationThread::setSpeed(Apple1Config::Speed nSpeed)
+{
+	this->nSpeed = nSpeed;
+	Wake();
+}
+
+Apple1Config::Speed Apple1EmulationThread::getSpeed()
+{
+	return nSpeed;
+}
+
+Apple1CpuState Apple1EmulationThread::getState() const
+{
+	return state.Load();
+}
+
+void Apple1EmulationThread::ThreadLoop()
+{
+	using clock = std::chrono::steady_clock;
+
+	// Frame speed keeps its meaning of one instruction per (60 Hz) frame
+	const auto tFrame = std::chrono::microseconds(16667);
+	const auto tSlice = std::chrono::milliseconds(1);
+
+	auto tDeadline = clock::now();
+
+	while (!bStop)
+	{
+		RunCommands();
+
+		uint8_t key;
+		while (keyRing.Pop(key))
+			machine->kbd->PushKey(key);
+
+		// the program only polls the keyboard - run it at the real clock in coarse slices
+		// and sleep in between, so a timed prompt or delay loop keeps its time while the
+		// host idles; a key or command ends the sleep early
+		if (bRunning && nSpeed != Apple1Config::Speed::Frame && IsIdle())
+		{
+			auto tSlice = clock::now();
+			RunTicks((uint64_t)nClockHz * nIdleSliceMs / 1000);
+			Publish();
+			WaitUntil(tSlice + std::chrono::milliseconds(nIdleSliceMs));
+			tDeadline = clock::now();
+			continue;
+		}
+
+		uint32_t nSteps = nStepRequests.exchange(0);
+		if (!bRunning)
+		{
+			RunInstructions(nSteps);
+			Publish();
+			if (nSteps == 0)
+				WaitUntil(clock::now() + std::chrono::milliseconds(100));
+			tDeadline = clock::now();
+			continue;
+		}
+
+		// pasted text is typed in as fast as the program takes it, like with speed = max
+		bool bPasting = !machine->kbd->Empty();
+
+		// warp: real time while the program polls the keyboard ($D011), so typing and
+		// waiting feel like the real machine, unthrottled as soon as it computes or prints
+		Apple1Config::Speed nSpeedNow = nSpeed;
+		bWarping = nSpeedNow == Apple1Config::Speed::Warp && !machine->IsWaitingForKey();
+
+		if (nSpeedNow == Apple1Config::Speed::Unlimited || bWarping || bPasting)
+		{
+			RunInstructions(1000);
+			tDeadline = clock::now();
+		}
+		else if (nSpeedNow == Apple1Config::Speed::Clock || nSpeedNow == Apple1Config::Speed::Warp)
+		{
+			RunTicks(nClockHz / 1000);
+			tDeadline += tSlice;
+		}
+		else
+		{
+			RunInstructions(1);
+			tDeadline += tFrame;
+		}
+
+		Publish();
+
+		// fallen behind more than 100ms (e.g. debugger, suspended laptop) - do not race to catch up
+		auto tNow = clock::now();
+		if (tDeadline + std::chrono::milliseconds(100) < tNow)
+			tDeadline = tNow;
+
+		if (tDeadline > tNow)
+			WaitUntil(tDeadline);
+	}
+}
+
+void Apple1EmulationThread::RunCommands()
+{
+	std::vector<std::function<void()>> vRun;
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		vRun.swap(vCommands);
+	}
+
+	for (auto& fn : vRun)
+		fn();
+
+	if (!vRun.empty())
+		Publish();
+}
+
+bool Apple1EmulationThread::IsIdle()
+{
+	// keys queued or presented but not read yet, or serial input for the program
+	bool bKeyPending = !machine->kbd->Empty() || (machine->bus->pia->cpuRead(0xD011, true) & 0x80) == 0x80 ||
+		(machine->bus->acia && machine->bus->acia->ReceivePending());
+	if (bKeyPending)
+		nLastKeyCycle = machine->getCycles();
+
+	return machine->IsWaitingForKey() && !bKeyPending && machine->getCycles() - nLastKeyCycle >= nParkAfterCycles;
+}
+
+void Apple1EmulationThread::RunInstructions(uint32_t nCount)
+{
+	auto tStart = std::chrono::steady_clock::now();
+
+	for (uint32_t i = 0; i < nCount; i++)
+		machine->Step();
+
+	nInstructions += nCount;
+	nBusyNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+// nClockHz paces master clock ticks, the CPU gets fewer cycles with DRAM refresh on
+void Apple1EmulationThread::RunTicks(uint64_t nTicks)
+{
+	auto tStart = std::chrono::steady_clock::now();
+
+	uint64_t nTarget = machine->bus->getClockTicks() + nTicks;
+	while (machine->bus->getClockTicks() < nTarget)
+	{
+		machine->Step();
+		nInstructions++;
+	}
+
+	nBusyNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+void Apple1EmulationThread::Publish()
+{
+	auto& cpu = *machine->bus->cpu;
+
+	Apple1CpuState s;
+	s.a = cpu.a;
+	s.x = cpu.x;
+	s.y = cpu.y;
+	s.stkp = cpu.stkp;
+	s.status = cpu.status;
+	s.pc = cpu.pc;
+	for (int i = 0; i < 6; i++)
+		s.vectors[i] = machine->bus->ram[0xFFFA + i];
+	s.bWaitingForKey = machine->IsWaitingForKey();
+	s.bWarping = bWarping;
+	s.nKeysQueued = (uint32_t)(machine->kbd->Size() + keyRing.Size());
+	s.nDroppedKeys = machine->kbd->getDroppedKeys() + nDroppedKeys;
+	s.nDroppedSerial = machine->bus->acia ? machine->bus->acia->getDroppedBytes() : 0;
+	s.nCycles = machine->getCycles();
+	s.nClockTicks = machine->bus->getClockTicks();
+	s.nInstructions = nInstructions;
+	s.nBusyNanos = nBusyNanos;
+
+	state.Store(s);
+}
+
+void Apple1EmulationThread::Wake()
+{
+	// set under the mutex, so the flag cannot slip in between check and wait of WaitUntil
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		bWake = true;
+	}
+	cvWake.notify_one();
+}
+
+void Apple1EmulationThread::WaitUntil(std::chrono::steady_clock::time_point t)
+{
+	// woken early by commands, keys, steps and Stop
+	std::unique_lock<std::mutex> lock(mtx);
+	cvWake.wait_until(lock, t, [&] { return bWake.load(); });
+	bWake = false;
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Apple1Config.h"
+#include "Apple1Machine.h"
+#include "Seqlock.h"
+#include "SpscRing.h"
+
+/*
+Runs an Apple1Machine on its own thread, paced by the configured speed instead
+of the frontend's frame rate. The frontend talks to it without locks on the
+hot paths:
+
+	keys typed		SPSC ring frontend -> emulation, see PushKey
+	terminal output	SPSC ring in Apple1Terminal, frontend calls ProcessOutput - when
+					it falls behind the PIA reports the display busy and the CPU waits
+	CPU registers	seqlock snapshot published after every slice, see getState
+
+Everything else (reset, loading, pasting, saving) is rare and handed over with
+Execute, which runs a function on the emulation thread between two instructions
+while the caller waits.
+*/
+
+struct Apple1CpuState
+{
+	uint8_t a = 0;
+	uint8_t x = 0;
+	uint8_t y = 0;
+	uint8_t stkp = 0;
+	uint8_t status = 0;
+	uint16_t pc = 0;
+	uint8_t vectors[6] = {};		// $FFFA-$FFFF as seen in RAM
+	bool bWaitingForKey = false;
+	bool bWarping = false;			// speed = warp and currently unthrottled
+	uint32_t nKeysQueued = 0;
+	uint32_t nDroppedKeys = 0;		// lost in the key ring or the keyboard queue
+	uint32_t nDroppedSerial = 0;	// serial card output the host side did not take
+	uint64_t nCycles = 0;
+	uint64_t nClockTicks = 0;		// master clock ticks incl. DRAM refresh, see Bus::getClockTicks
+	uint64_t nInstructions = 0;
+	uint64_t nBusyNanos = 0;		// host time spent executing, without pauses and pacing
+};
+
+class Apple1EmulationThread
+{
+public:
+	Apple1EmulationThread(std::shared_ptr<Apple1Machine> machine, const Apple1Config& config);
+	~Apple1EmulationThread();
+
+	void Start();
+	void Stop();
+
+	// runs fn on the emulation thread (directly while it is not started) and waits for it
+	void Execute(const std::function<void()>& fn);
+
+	// key typed in the frontend, false (and counted as dropped) when the ring is full
+	bool PushKey(uint8_t key);
+
+	// stopped: only single steps are executed
+	void setRunning(bool bRunning);
+	bool isRunning();
+	void Step();
+
+	void setSpeed(Apple1Config::Speed nSpeed);
+	Apple1Config::Speed getSpeed();
+
+	Apple1CpuState getState() const;
+
+private:
+	std::shared_ptr<Apple1Machine> machine;
+	std::atomic<Apple1Config::Speed> nSpeed;
+	uint32_t nClockHz;
+	bool bWarping;
+
+	std::thread thread;
+	std::atomic<bool> bStop;
+	std::atomic<bool> bWake;
+	std::atomic<bool> bRunning;
+	std::atomic<uint32_t> nStepRequests;
+
+	SpscRing<uint8_t, 1024> keyRing;
+	std::atomic<uint32_t> nDroppedKeys;		// typed while keyRing was full, counted by the frontend
+	Seqlock<Apple1CpuState> state;
+	uint64_t nInstructions;
+	uint64_t nBusyNanos;
+	uint64_t nLastKeyCycle;
+
+	// idle parking only after two keyboard poll windows (see Apple1Machine) without any key,
+	// so the program has fully dealt with the last one
+	const static uint64_t nParkAfterCycles = 2 * 65536;
+	// emulated time per wake-up while parked
+	const static uint32_t nIdleSliceMs = 50;
+
+	std::mutex mtx;
+	std::condition_variable cvWake;
+	std::vector<std::function<void()>> vCommands;
+
+	void ThreadLoop();
+	void RunCommands();
+	bool IsIdle();
+	void RunInstructions(uint32_t nCount);
+	void RunTicks(uint64_t nTicks);
+	void Publish();
+	void Wake();
+	void WaitUntil(std::chrono::steady_clock::time_point t);
+};
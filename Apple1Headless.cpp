@@ -0,0 +1,37 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Apple1Console.h"
+#include "BatchRunner.h"
+
+/*
+Frontend without olcPixelGameEngine - builds against the core library only
+and runs on machines without X11/OpenGL.
+*/
+
+int main(int argc, char* argv[])
+{
+	std::vector<std::string> vArgs(argv + 1, argv + argc);
+	std::vector<std::string> vRest;
+	std::string sError;
+
+	Apple1Config config;
+	if (!config.ParseArgs(vArgs, vRest, sError))
+	{
+		std::cerr << sError << std::endl;
+		return 1;
+	}
+
+	if (config.nFrontend == Apple1Config::Frontend::Batch)
+		return BatchRunner::Main(vRest, config);
+
+	// stdin/stdout terminal - no window
+	if (config.nFrontend == Apple1Config::Frontend::Console)
+		return Apple1Console::Main(vRest, config);
+
+	std::cerr << "usage: olcApple1Headless --batch [-j threads] [-c cycles] [-k keydelay] [-l file[@addr]] [-r addr] [-o outdir] [-g golden] input files..." << std::endl;
+	std::cerr << "       olcApple1Headless --console [-c cycles] [-k keydelay] [-l file[@addr]] [-r addr] [-s file.bas]" << std::endl;
+	std::cerr << "machine options: " << Apple1Config::Usage() << std::endl;
+	return 1;
+}
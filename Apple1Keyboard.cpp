@@ -1,7 +1,7 @@
 #include "Apple1Keyboard.h"
 
-Apple1Keyboard::Apple1Keyboard(std::shared_ptr<MC6821> pia, std::shared_ptr<olc::PixelGameEngine> olc) :
-	pia{ pia }, olc{ olc }
+Apple1Keyboard::Apple1Keyboard(std::shared_ptr<Apple1EmulationThread> emu, std::shared_ptr<olc::PixelGameEngine> olc) :
+	emu{ emu }, olc{ olc }
 {
 	// map keys
 	mapKeys = MapOLCKeyToAppleKey();
@@ -12,45 +12,23 @@ Apple1Keyboard::~Apple1Keyboard()
 {
 }
 
-void Apple1Keyboard::ProcessKey()
+bool Apple1Keyboard::ProcessKey()
 {
-	uint8_t keyPressed = 0;
+	// hand all keys pressed since last frame to the emulation thread, its keyboard
+	// queue presents them to the PIA one by one as the CPU reads them
+	const auto& keys = olc->GetKey(olc::SHIFT).bHeld ? mapShiftedKeys : mapKeys;
 
-	if (olc->GetKey(olc::SHIFT).bHeld)
+	bool bPressed = false;
+	for (const auto& k : keys)
 	{
-		// check for shifted keys pressed
-		for (const auto& k : mapShiftedKeys)
+		if (olc->GetKey(k.first).bPressed)
 		{
-			if (olc->GetKey(k.first).bPressed)
-			{
-				keyPressed = k.second;
-				break;
-			}
-		}
-	}
-	else
-	{
-		// check for regular keys pressed
-		for (const auto& k : mapKeys)
-		{
-			if (olc->GetKey(k.first).bPressed)
-			{
-				keyPressed = k.second;
-				break;
-			}
+			emu->PushKey(k.second);
+			bPressed = true;
 		}
 	}
 
-	if (keyPressed)
-	{
-		if (keyPressed > 0 && keyPressed < 0x60)
-		{
-			pia->setCA1(SignalProcessing::Signal::Fall); // bring keyboard strobe to low to force active transition
-			pia->setInputA(keyPressed | 0x80); // bit 7 is constantly set (+5V)
-			pia->setCA1(SignalProcessing::Signal::Rise); // send only pulse
-			pia->setCA1(SignalProcessing::Signal::Fall); // 20 micro secs are not worth emulating
-		}
-	}
+	return bPressed;
 }
 
 
@@ -1,21 +1,22 @@
 #pragma once
-#include "MC6821.h"
+#include "Apple1EmulationThread.h"
 #include "olcPixelGameEngine.h"
 
 class Apple1Keyboard
 {
 public:
-	Apple1Keyboard(std::shared_ptr<MC6821> pia, std::shared_ptr<olc::PixelGameEngine> olc);
+	Apple1Keyboard(std::shared_ptr<Apple1EmulationThread> emu, std::shared_ptr<olc::PixelGameEngine> olc);
 	~Apple1Keyboard();
 
-	void ProcessKey();
+	// returns true when a key was pressed
+	bool ProcessKey();
 
 private:
 	std::map<olc::Key, uint8_t> mapKeys;
 	std::map<olc::Key, uint8_t> mapShiftedKeys;
 	std::map<olc::Key, uint8_t> MapOLCKeyToAppleKey();
 	std::map<olc::Key, uint8_t> MapOLCShiftedKeyToAppleKey();
-	std::shared_ptr<MC6821> pia;
+	std::shared_ptr<Apple1EmulationThread> emu;
 	std::shared_ptr<olc::PixelGameEngine> olc;
 };
 
@@ -0,0 +1,121 @@
+#include "Apple1KeyboardQueue.h"
+
+Apple1KeyboardQueue::Apple1KeyboardQueue(std::shared_ptr<MC6821> pia, size_t nCapacity) :
+	pia{ pia }, nCapacity{ nCapacity }
+{
+	nKeyDelay = 0;
+	nDelayRemaining = 0;
+	nDroppedKeys = 0;
+	bAwaitRead = false;
+}
+
+Apple1KeyboardQueue::~Apple1KeyboardQueue()
+{
+}
+
+bool Apple1KeyboardQueue::PushKey(uint8_t key)
+{
+	if (key == 0 || key >= 0x60)
+		return false;
+
+	if (queue.size() >= nCapacity)
+	{
+		nDroppedKeys++;
+		return false;
+	}
+
+	queue.push_back(key);
+	return true;
+}
+
+size_t Apple1KeyboardQueue::PushText(const std::string& sText)
+{
+	size_t nPushed = 0;
+
+	for (size_t i = 0; i < sText.size(); i++)
+	{
+		uint8_t key = (uint8_t)sText[i];
+
+		// CR LF counts as one key
+		if (key == '\r' && i + 1 < sText.size() && sText[i + 1] == '\n')
+			continue;
+
+		if (key == '\n')
+			key = 0x0D;
+		else if (key >= 0x61 && key <= 0x7A)
+			key &= 0x5F;
+
+		if (PushKey(key))
+			nPushed++;
+	}
+
+	return nPushed;
+}
+
+void Apple1KeyboardQueue::Clock(uint32_t nCycles)
+{
+	if (bAwaitRead)
+	{
+		// KBDCR bit 7 is cleared when the CPU reads KBD
+		if ((pia->cpuRead(0xD011, true) & 0x80) == 0x80)
+			return;
+
+		bAwaitRead = false;
+		nDelayRemaining = nKeyDelay;
+	}
+
+	if (queue.empty())
+		return;
+
+	if (nDelayRemaining > nCycles)
+	{
+		nDelayRemaining -= nCycles;
+		return;
+	}
+	nDelayRemaining = 0;
+
+	PresentKey(queue.front());
+	queue.pop_front();
+}
+
+void Apple1KeyboardQueue::Clear()
+{
+	queue.clear();
+	bAwaitRead = false;
+	nDelayRemaining = 0;
+}
+
+bool Apple1KeyboardQueue::Empty()
+{
+	return queue.empty();
+}
+
+size_t Apple1KeyboardQueue::Size()
+{
+	return queue.size();
+}
+
+void Apple1KeyboardQueue::setKeyDelay(uint32_t nCycles)
+{
+	nKeyDelay = nCycles;
+}
+
+uint32_t Apple1KeyboardQueue::getKeyDelay()
+{
+	return nKeyDelay;
+}
+
+uint32_t Apple1KeyboardQueue::getDroppedKeys()
+{
+	return nDroppedKeys;
+}
+
+void Apple1KeyboardQueue::PresentKey(uint8_t key)
+{
+	pia->setCA1(SignalProcessing::Signal::Fall); // bring keyboard strobe to low to force active transition
+	pia->setInputA(key | 0x80); // bit 7 is constantly set (+5V)
+	pia->setCA1(SignalProcessing::Signal::Rise); // send only pulse
+	pia->setCA1(SignalProcessing::Signal::Fall); // 20 micro secs are not worth emulating
+
+	bAwaitRead = true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "MC6821.h"
+
+/*
+Keyboard FIFO in front of the PIA port A. The next key is only presented after
+the CPU has read the previous one from KBD ($D010), which clears the CA1 flag
+in KBDCR ($D011), plus an optional delay in CPU cycles. This way no key is lost
+no matter how fast keys are typed, pasted or scripted.
+*/
+
+class Apple1KeyboardQueue
+{
+public:
+	Apple1KeyboardQueue(std::shared_ptr<MC6821> pia, size_t nCapacity = 65536);
+	~Apple1KeyboardQueue();
+
+	// Apple 1 key code 0x01..0x5F, returns false when queue is full
+	bool PushKey(uint8_t key);
+	// ASCII text, lower case is made upper, LF and CR LF become CR
+	size_t PushText(const std::string& sText);
+
+	// advance by CPU cycles elapsed since last call and present next key when due
+	void Clock(uint32_t nCycles);
+
+	void Clear();
+	bool Empty();
+	size_t Size();
+
+	void setKeyDelay(uint32_t nCycles);
+	uint32_t getKeyDelay();
+	uint32_t getDroppedKeys();
+
+private:
+	std::shared_ptr<MC6821> pia;
+	std::deque<uint8_t> queue;
+	size_t nCapacity;
+
+	uint32_t nKeyDelay;
+	uint32_t nDelayRemaining;
+	uint32_t nDroppedKeys;
+	bool bAwaitRead;
+
+	void PresentKey(uint8_t key);
+};
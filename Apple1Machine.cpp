@@ -0,0 +1,205 @@
+#include "Apple1Machine.h"
+
+#include <algorithm>
+
+Apple1Machine::Apple1Machine(const Apple1Config& config)
+{
+	bus = std::make_shared<Bus>(config);
+	term = std::make_shared<Apple1Terminal>(bus->pia, config.sCharmap);
+	text = std::make_shared<Apple1TerminalText>();
+	term->setSink(text);
+	kbd = std::make_shared<Apple1KeyboardQueue>(bus->pia);
+
+	bRefreshExact = bus->IsRefreshExact();
+	nCycles = 0;
+	nPollWindowEnd = nPollWindow;
+	nNextEvent = nPollWindowEnd;
+	nPollCountStart = 0;
+	bWaitingForKey = false;
+	bRunPending = false;
+	nRunAddress = 0x0000;
+}
+
+Apple1Machine::~Apple1Machine()
+{
+}
+
+void Apple1Machine::Reset()
+{
+	bus->reset();
+	term->ClearScreen();
+	text->ClearText();
+	kbd->Clear();
+	bWaitingForKey = false;
+	bRunPending = false;
+	nPollCountStart = bus->pia->getCRAReadCount();
+	nPollWindowEnd = nCycles + nPollWindow;
+	nNextEvent = nCycles;
+}
+
+void Apple1Machine::TypeText(const std::string& sText)
+{
+	kbd->PushText(sText);
+}
+
+Apple1Machine::ExitReason Apple1Machine::Run(uint64_t nCycleBudget)
+{
+	uint64_t nCycleLimit = nCycles + nCycleBudget;
+	uint8_t nSamePc = 0;
+
+	while (nCycles < nCycleLimit)
+	{
+		uint16_t nLastPc = bus->cpu->pc;
+
+		ExecuteInstruction();
+
+		// an instruction jumping onto itself never leaves again
+		// (first step after reset only consumes the reset cycles)
+		if (bus->cpu->pc == nLastPc)
+		{
+			if (++nSamePc == 2)
+				return ExitReason::Halted;
+		}
+		else
+			nSamePc = 0;
+
+		while (term->ProcessOutput());
+
+		if (nCycles >= nNextEvent)
+		{
+			bool bPollWindow = nCycles >= nPollWindowEnd;
+			CheckEvents();
+
+			// serial input for the program counts as input too
+			if (bPollWindow && bWaitingForKey && kbd->Empty() && !(bus->acia && bus->acia->ReceivePending()))
+				return ExitReason::InputDrained;
+		}
+	}
+
+	return ExitReason::CycleBudget;
+}
+
+void Apple1Machine::Step()
+{
+	ExecuteInstruction();
+
+	if (nCycles >= nNextEvent)
+		CheckEvents();
+}
+
+void Apple1Machine::RunAt(uint16_t nAddr)
+{
+	nRunAddress = nAddr;
+	bRunPending = true;
+
+	if (bWaitingForKey)
+	{
+		bus->cpu->pc = nRunAddress;
+		bRunPending = false;
+	}
+}
+
+LoadResult Apple1Machine::Load(const std::string& sSpec)
+{
+	LoadResult result = ProgramLoader::LoadFile(*bus, sSpec);
+
+	if (result.bRun)
+		RunAt(result.nRunAddress);
+
+	return result;
+}
+
+uint32_t Apple1Machine::ExecuteInstruction()
+{
+	uint32_t nInstrCycles = 0;
+
+	// instant load takes the place of the ACI read routine
+	if (bus->aci && bus->aci->IsReadEntry(bus->cpu->pc))
+		bus->aci->InstantLoad(*bus);
+
+	// CFFA1 firmware calls run natively
+	if (bus->cffa1 && bus->cffa1->IsApiEntry(bus->cpu->pc))
+		bus->cffa1->Call(*bus);
+
+	if (bRefreshExact)
+	{
+		do
+		{
+			bus->clockExact();
+			nInstrCycles++;
+		} while (!bus->cpu->complete());
+	}
+	else
+	{
+		do
+		{
+			bus->clock();
+			nInstrCycles++;
+		} while (!bus->cpu->complete());
+	}
+
+	nCycles += nInstrCycles;
+
+	kbd->Clock(nInstrCycles);
+
+	return nInstrCycles;
+}
+
+void Apple1Machine::CheckPolling()
+{
+	uint32_t nPollCount = bus->pia->getCRAReadCount();
+	bWaitingForKey = (uint32_t)(nPollCount - nPollCountStart) >= nPollThreshold;
+	nPollCountStart = nPollCount;
+	nPollWindowEnd = nCycles + nPollWindow;
+
+	if (bWaitingForKey && bRunPending)
+	{
+		bus->cpu->pc = nRunAddress;
+		bRunPending = false;
+		bWaitingForKey = false;
+	}
+}
+
+void Apple1Machine::CheckEvents()
+{
+	if (nCycles >= nPollWindowEnd)
+		CheckPolling();
+	nNextEvent = nPollWindowEnd;
+
+	// the serial card takes a received byte once per character time; while its IRQ is
+	// held but masked by the CPU it is offered again after every instruction
+	if (bus->acia)
+	{
+		bool bIrq = bus->acia->Update();
+		if (bIrq)
+			bus->cpu->irq();
+
+		nNextEvent = std::min<uint64_t>(nNextEvent, nCycles + (bIrq ? 1 : bus->acia->getCharacterCycles()));
+	}
+}
+
+bool Apple1Machine::IsWaitingForKey()
+{
+	return bWaitingForKey;
+}
+
+const std::string& Apple1Machine::getOutput()
+{
+	return text->getText();
+}
+
+uint64_t Apple1Machine::getCycles()
+{
+	return nCycles;
+}
+
+const char* Apple1Machine::ExitReasonName(ExitReason r)
+{
+	switch (r)
+	{
+	case ExitReason::CycleBudget: return "budget";
+	case ExitReason::InputDrained: return "drained";
+	case ExitReason::Halted: return "halted";
+	}
+	return "?";
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Apple1Config.h"
+#include "Bus.h"
+#include "Apple1Terminal.h"
+#include "Apple1TerminalText.h"
+#include "Apple1KeyboardQueue.h"
+#include "ProgramLoader.h"
+
+/*
+A complete Apple 1 (Bus, 6502, PIA, terminal) without any frontend attached. Keyboard
+input is scripted as text, terminal output is collected as text. This allows
+to run many independent machines side by side, e.g. for batch regression runs.
+*/
+
+class Apple1Machine
+{
+public:
+	Apple1Machine(const Apple1Config& config = Apple1Config());
+	~Apple1Machine();
+
+	enum ExitReason : uint8_t
+	{
+		CycleBudget = 0,	// cycle budget used up
+		InputDrained = 1,	// all scripted input consumed and machine waits for next key
+		Halted = 2			// CPU loops on one instruction (e.g. JMP *)
+	};
+
+public:
+	std::shared_ptr<Bus> bus;
+	std::shared_ptr<Apple1Terminal> term;
+	std::shared_ptr<Apple1KeyboardQueue> kbd;
+
+	void Reset();
+	void TypeText(const std::string& sText);
+	ExitReason Run(uint64_t nCycleBudget);
+	void Step();
+
+	// continue execution at nAddr as soon as the program waits for a key,
+	// i.e. once the monitor has set up the PIA after a reset
+	void RunAt(uint16_t nAddr);
+
+	// load program into RAM (see ProgramLoader::LoadFile), run it if it contains an 'R' command
+	LoadResult Load(const std::string& sSpec);
+
+	bool IsWaitingForKey();
+	const std::string& getOutput();
+	uint64_t getCycles();
+
+	static const char* ExitReasonName(ExitReason r);
+
+private:
+	std::shared_ptr<Apple1TerminalText> text;
+	uint64_t nCycles;
+	bool bRefreshExact;		// clock the bus with Bus::clockExact
+
+	// the one compare per instruction: keyboard poll windows and serial card receive
+	// events are handled when the cycle count reaches nNextEvent
+	uint64_t nNextEvent;
+
+	// keyboard polling detection - sampled in windows of nPollWindow cycles
+	const static uint64_t nPollWindow = 65536;
+	const static uint32_t nPollThreshold = 2048;
+	uint64_t nPollWindowEnd;
+	uint32_t nPollCountStart;
+	bool bWaitingForKey;
+
+	bool bRunPending;
+	uint16_t nRunAddress;
+
+	uint32_t ExecuteInstruction();
+	void CheckPolling();
+	void CheckEvents();
+};
@@ -0,0 +1,57 @@
+#include "Apple1Paste.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+std::string Apple1Paste::ReadClipboard()
+{
+	std::string sText;
+
+#ifdef _WIN32
+	if (!OpenClipboard(nullptr))
+		return sText;
+
+	HANDLE hData = GetClipboardData(CF_TEXT);
+	if (hData != nullptr)
+	{
+		const char* pText = (const char*)GlobalLock(hData);
+		if (pText != nullptr)
+		{
+			sText = pText;
+			GlobalUnlock(hData);
+		}
+	}
+
+	CloseClipboard();
+#else
+	// PGE owns the X11 event loop, so let a helper do the selection transfer
+	FILE* pipe = popen("xclip -o -selection clipboard 2>/dev/null || xsel --clipboard --output 2>/dev/null", "r");
+	if (pipe == nullptr)
+		return sText;
+
+	char buffer[4096];
+	size_t n;
+	while ((n = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+		sText.append(buffer, n);
+
+	pclose(pipe);
+#endif
+
+	return sText;
+}
+
+std::string Apple1Paste::ReadFile(const std::string& sFileName)
+{
+	std::ifstream ifs(sFileName, std::ifstream::binary);
+	if (!ifs.is_open())
+		return std::string();
+
+	std::stringstream ss;
+	ss << ifs.rdbuf();
+	return ss.str();
+}
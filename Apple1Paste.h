@@ -0,0 +1,17 @@
+#pragma once
+#include <string>
+
+/*
+Text sources for pasting into the Apple 1 keyboard.
+*/
+
+class Apple1Paste
+{
+public:
+	// text content of the system clipboard, empty if not available
+	// (X11: taken via xclip or xsel)
+	static std::string ReadClipboard();
+
+	// whole content of a text file, empty if not readable
+	static std::string ReadFile(const std::string& sFileName);
+};
@@ -0,0 +1,363 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+/*
+The stock Apple 1 ROM images, embedded so that a machine comes up without any
+file I/O. Generated from Apple1_HexMonitor.rom, Apple1_basic.rom and
+Apple1_charmap.rom - the files can still be given instead (see Apple1Config).
+*/
+
+struct Apple1Roms
+{
+	// Woz Monitor, $FF00-$FFFF
+	static constexpr std::array<uint8_t, 256> HexMonitor =
+	{
+		0xD8, 0x58, 0xA0, 0x7F, 0x8C, 0x12, 0xD0, 0xA9, 0xA7, 0x8D, 0x11, 0xD0, 0x8D, 0x13, 0xD0, 0xC9,
+		0xDF, 0xF0, 0x13, 0xC9, 0x9B, 0xF0, 0x03, 0xC8, 0x10, 0x0F, 0xA9, 0xDC, 0x20, 0xEF, 0xFF, 0xA9,
+		0x8D, 0x20, 0xEF, 0xFF, 0xA0, 0x01, 0x88, 0x30, 0xF6, 0xAD, 0x11, 0xD0, 0x10, 0xFB, 0xAD, 0x10,
+		0xD0, 0x99, 0x00, 0x02, 0x20, 0xEF, 0xFF, 0xC9, 0x8D, 0xD0, 0xD4, 0xA0, 0xFF, 0xA9, 0x00, 0xAA,
+		0x0A, 0x85, 0x2B, 0xC8, 0xB9, 0x00, 0x02, 0xC9, 0x8D, 0xF0, 0xD4, 0xC9, 0xAE, 0x90, 0xF4, 0xF0,
+		0xF0, 0xC9, 0xBA, 0xF0, 0xEB, 0xC9, 0xD2, 0xF0, 0x3B, 0x86, 0x28, 0x86, 0x29, 0x84, 0x2A, 0xB9,
+		0x00, 0x02, 0x49, 0xB0, 0xC9, 0x0A, 0x90, 0x06, 0x69, 0x88, 0xC9, 0xFA, 0x90, 0x11, 0x0A, 0x0A,
+		0x0A, 0x0A, 0xA2, 0x04, 0x0A, 0x26, 0x28, 0x26, 0x29, 0xCA, 0xD0, 0xF8, 0xC8, 0xD0, 0xE0, 0xC4,
+		0x2A, 0xF0, 0x97, 0x24, 0x2B, 0x50, 0x10, 0xA5, 0x28, 0x81, 0x26, 0xE6, 0x26, 0xD0, 0xB5, 0xE6,
+		0x27, 0x4C, 0x44, 0xFF, 0x6C, 0x24, 0x00, 0x30, 0x2B, 0xA2, 0x02, 0xB5, 0x27, 0x95, 0x25, 0x95,
+		0x23, 0xCA, 0xD0, 0xF7, 0xD0, 0x14, 0xA9, 0x8D, 0x20, 0xEF, 0xFF, 0xA5, 0x25, 0x20, 0xDC, 0xFF,
+		0xA5, 0x24, 0x20, 0xDC, 0xFF, 0xA9, 0xBA, 0x20, 0xEF, 0xFF, 0xA9, 0xA0, 0x20, 0xEF, 0xFF, 0xA1,
+		0x24, 0x20, 0xDC, 0xFF, 0x86, 0x2B, 0xA5, 0x24, 0xC5, 0x28, 0xA5, 0x25, 0xE5, 0x29, 0xB0, 0xC1,
+		0xE6, 0x24, 0xD0, 0x02, 0xE6, 0x25, 0xA5, 0x24, 0x29, 0x07, 0x10, 0xC8, 0x48, 0x4A, 0x4A, 0x4A,
+		0x4A, 0x20, 0xE5, 0xFF, 0x68, 0x29, 0x0F, 0x09, 0xB0, 0xC9, 0xBA, 0x90, 0x02, 0x69, 0x06, 0x2C,
+		0x12, 0xD0, 0x30, 0xFB, 0x8D, 0x12, 0xD0, 0x60, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00
+	};
+
+	// Integer BASIC, $E000-$EFFF
+	static constexpr std::array<uint8_t, 4096> Basic =
+	{
+		0x4C, 0xB0, 0xE2, 0xAD, 0x11, 0xD0, 0x10, 0xFB, 0xAD, 0x10, 0xD0, 0x60, 0x8A, 0x29, 0x20, 0xF0,
+		0x23, 0xA9, 0xA0, 0x85, 0xE4, 0x4C, 0xC9, 0xE3, 0xA9, 0x20, 0xC5, 0x24, 0xB0, 0x0C, 0xA9, 0x8D,
+		0xA0, 0x07, 0x20, 0xC9, 0xE3, 0xA9, 0xA0, 0x88, 0xD0, 0xF8, 0xA0, 0x00, 0xB1, 0xE2, 0xE6, 0xE2,
+		0xD0, 0x02, 0xE6, 0xE3, 0x60, 0x20, 0x15, 0xE7, 0x20, 0x76, 0xE5, 0xA5, 0xE2, 0xC5, 0xE6, 0xA5,
+		0xE3, 0xE5, 0xE7, 0xB0, 0xEF, 0x20, 0x6D, 0xE0, 0x4C, 0x3B, 0xE0, 0xA5, 0xCA, 0x85, 0xE2, 0xA5,
+		0xCB, 0x85, 0xE3, 0xA5, 0x4C, 0x85, 0xE6, 0xA5, 0x4D, 0x85, 0xE7, 0xD0, 0xDE, 0x20, 0x15, 0xE7,
+		0x20, 0x6D, 0xE5, 0xA5, 0xE4, 0x85, 0xE2, 0xA5, 0xE5, 0x85, 0xE3, 0xB0, 0xC7, 0x86, 0xD8, 0xA9,
+		0xA0, 0x85, 0xFA, 0x20, 0x2A, 0xE0, 0x98, 0x85, 0xE4, 0x20, 0x2A, 0xE0, 0xAA, 0x20, 0x2A, 0xE0,
+		0x20, 0x1B, 0xE5, 0x20, 0x18, 0xE0, 0x84, 0xFA, 0xAA, 0x10, 0x18, 0x0A, 0x10, 0xE9, 0xA5, 0xE4,
+		0xD0, 0x03, 0x20, 0x11, 0xE0, 0x8A, 0x20, 0xC9, 0xE3, 0xA9, 0x25, 0x20, 0x1A, 0xE0, 0xAA, 0x30,
+		0xF5, 0x85, 0xE4, 0xC9, 0x01, 0xD0, 0x05, 0xA6, 0xD8, 0x4C, 0xCD, 0xE3, 0x48, 0x84, 0xCE, 0xA2,
+		0xED, 0x86, 0xCF, 0xC9, 0x51, 0x90, 0x04, 0xC6, 0xCF, 0xE9, 0x50, 0x48, 0xB1, 0xCE, 0xAA, 0x88,
+		0xB1, 0xCE, 0x10, 0xFA, 0xE0, 0xC0, 0xB0, 0x04, 0xE0, 0x00, 0x30, 0xF2, 0xAA, 0x68, 0xE9, 0x01,
+		0xD0, 0xE9, 0x24, 0xE4, 0x30, 0x03, 0x20, 0xF8, 0xEF, 0xB1, 0xCE, 0x10, 0x10, 0xAA, 0x29, 0x3F,
+		0x85, 0xE4, 0x18, 0x69, 0xA0, 0x20, 0xC9, 0xE3, 0x88, 0xE0, 0xC0, 0x90, 0xEC, 0x20, 0x0C, 0xE0,
+		0x68, 0xC9, 0x5D, 0xF0, 0xA4, 0xC9, 0x28, 0xD0, 0x8A, 0xF0, 0x9E, 0x20, 0x18, 0xE1, 0x95, 0x50,
+		0xD5, 0x78, 0x90, 0x11, 0xA0, 0x2B, 0x4C, 0xE0, 0xE3, 0x20, 0x34, 0xEE, 0xD5, 0x50, 0x90, 0xF4,
+		0x20, 0xE4, 0xEF, 0x95, 0x78, 0x4C, 0x23, 0xE8, 0x20, 0x34, 0xEE, 0xF0, 0xE7, 0x38, 0xE9, 0x01,
+		0x60, 0x20, 0x18, 0xE1, 0x95, 0x50, 0x18, 0xF5, 0x78, 0x4C, 0x02, 0xE1, 0xA0, 0x14, 0xD0, 0xD6,
+		0x20, 0x18, 0xE1, 0xE8, 0xB5, 0x50, 0x85, 0xDA, 0x65, 0xCE, 0x48, 0xA8, 0xB5, 0x78, 0x85, 0xDB,
+		0x65, 0xCF, 0x48, 0xC4, 0xCA, 0xE5, 0xCB, 0xB0, 0xE3, 0xA5, 0xDA, 0x69, 0xFE, 0x85, 0xDA, 0xA9,
+		0xFF, 0xA8, 0x65, 0xDB, 0x85, 0xDB, 0xC8, 0xB1, 0xDA, 0xD9, 0xCC, 0x00, 0xD0, 0x0F, 0x98, 0xF0,
+		0xF5, 0x68, 0x91, 0xDA, 0x99, 0xCC, 0x00, 0x88, 0x10, 0xF7, 0xE8, 0x60, 0xEA, 0xA0, 0x80, 0xD0,
+		0x95, 0xA9, 0x00, 0x20, 0x0A, 0xE7, 0xA0, 0x02, 0x94, 0x78, 0x20, 0x0A, 0xE7, 0xA9, 0xBF, 0x20,
+		0xC9, 0xE3, 0xA0, 0x00, 0x20, 0x9E, 0xE2, 0x94, 0x78, 0xEA, 0xEA, 0xEA, 0xB5, 0x51, 0x85, 0xCE,
+		0xB5, 0x79, 0x85, 0xCF, 0xE8, 0xE8, 0x20, 0xBC, 0xE1, 0xB5, 0x4E, 0xD5, 0x76, 0xB0, 0x15, 0xF6,
+		0x4E, 0xA8, 0xB1, 0xCE, 0xB4, 0x50, 0xC4, 0xE4, 0x90, 0x04, 0xA0, 0x83, 0xD0, 0xC1, 0x91, 0xDA,
+		0xF6, 0x50, 0x90, 0xE5, 0xB4, 0x50, 0x8A, 0x91, 0xDA, 0xE8, 0xE8, 0x60, 0xB5, 0x51, 0x85, 0xDA,
+		0x38, 0xE9, 0x02, 0x85, 0xE4, 0xB5, 0x79, 0x85, 0xDB, 0xE9, 0x00, 0x85, 0xE5, 0xA0, 0x00, 0xB1,
+		0xE4, 0x18, 0xE5, 0xDA, 0x85, 0xE4, 0x60, 0xB5, 0x53, 0x85, 0xCE, 0xB5, 0x7B, 0x85, 0xCF, 0xB5,
+		0x51, 0x85, 0xDA, 0xB5, 0x79, 0x85, 0xDB, 0xE8, 0xE8, 0xE8, 0xA0, 0x00, 0x94, 0x78, 0x94, 0xA0,
+		0xC8, 0x94, 0x50, 0xB5, 0x4D, 0xD5, 0x75, 0x08, 0x48, 0xB5, 0x4F, 0xD5, 0x77, 0x90, 0x07, 0x68,
+		0x28, 0xB0, 0x02, 0x56, 0x50, 0x60, 0xA8, 0xB1, 0xCE, 0x85, 0xE4, 0x68, 0xA8, 0x28, 0xB0, 0xF3,
+		0xB1, 0xDA, 0xC5, 0xE4, 0xD0, 0xED, 0xF6, 0x4F, 0xF6, 0x4D, 0xB0, 0xD7, 0x20, 0xD7, 0xE1, 0x4C,
+		0x36, 0xE7, 0x20, 0x54, 0xE2, 0x06, 0xCE, 0x26, 0xCF, 0x90, 0x0D, 0x18, 0xA5, 0xE6, 0x65, 0xDA,
+		0x85, 0xE6, 0xA5, 0xE7, 0x65, 0xDB, 0x85, 0xE7, 0x88, 0xF0, 0x09, 0x06, 0xE6, 0x26, 0xE7, 0x10,
+		0xE4, 0x4C, 0x7E, 0xE7, 0xA5, 0xE6, 0x20, 0x08, 0xE7, 0xA5, 0xE7, 0x95, 0xA0, 0x06, 0xE5, 0x90,
+		0x28, 0x4C, 0x6F, 0xE7, 0xA9, 0x55, 0x85, 0xE5, 0x20, 0x5B, 0xE2, 0xA5, 0xCE, 0x85, 0xDA, 0xA5,
+		0xCF, 0x85, 0xDB, 0x20, 0x15, 0xE7, 0x84, 0xE6, 0x84, 0xE7, 0xA5, 0xCF, 0x10, 0x09, 0xCA, 0x06,
+		0xE5, 0x20, 0x6F, 0xE7, 0x20, 0x15, 0xE7, 0xA0, 0x10, 0x60, 0x20, 0x6C, 0xEE, 0xF0, 0xC5, 0xFF,
+		0xC9, 0x84, 0xD0, 0x02, 0x46, 0xF8, 0xC9, 0xDF, 0xF0, 0x11, 0xC9, 0x9B, 0xF0, 0x06, 0x99, 0x00,
+		0x02, 0xC8, 0x10, 0x0A, 0xA0, 0x8B, 0x20, 0xC4, 0xE3, 0xA0, 0x01, 0x88, 0x30, 0xF6, 0x20, 0x03,
+		0xE0, 0xEA, 0xEA, 0x20, 0xC9, 0xE3, 0xC9, 0x8D, 0xD0, 0xD6, 0xA9, 0xDF, 0x99, 0x00, 0x02, 0x60,
+		0x20, 0xD3, 0xEF, 0x20, 0xCD, 0xE3, 0x46, 0xD9, 0xA9, 0xBE, 0x20, 0xC9, 0xE3, 0xA0, 0x00, 0x84,
+		0xFA, 0x24, 0xF8, 0x10, 0x0C, 0xA6, 0xF6, 0xA5, 0xF7, 0x20, 0x1B, 0xE5, 0xA9, 0xA0, 0x20, 0xC9,
+		0xE3, 0xA2, 0xFF, 0x9A, 0x20, 0x9E, 0xE2, 0x84, 0xF1, 0x8A, 0x85, 0xC8, 0xA2, 0x20, 0x20, 0x91,
+		0xE4, 0xA5, 0xC8, 0x69, 0x00, 0x85, 0xE0, 0xA9, 0x00, 0xAA, 0x69, 0x02, 0x85, 0xE1, 0xA1, 0xE0,
+		0x29, 0xF0, 0xC9, 0xB0, 0xF0, 0x03, 0x4C, 0x83, 0xE8, 0xA0, 0x02, 0xB1, 0xE0, 0x99, 0xCD, 0x00,
+		0x88, 0xD0, 0xF8, 0x20, 0x8A, 0xE3, 0xA5, 0xF1, 0xE5, 0xC8, 0xC9, 0x04, 0xF0, 0xA8, 0x91, 0xE0,
+		0xA5, 0xCA, 0xF1, 0xE0, 0x85, 0xE4, 0xA5, 0xCB, 0xE9, 0x00, 0x85, 0xE5, 0xA5, 0xE4, 0xC5, 0xCC,
+		0xA5, 0xE5, 0xE5, 0xCD, 0x90, 0x45, 0xA5, 0xCA, 0xF1, 0xE0, 0x85, 0xE6, 0xA5, 0xCB, 0xE9, 0x00,
+		0x85, 0xE7, 0xB1, 0xCA, 0x91, 0xE6, 0xE6, 0xCA, 0xD0, 0x02, 0xE6, 0xCB, 0xA5, 0xE2, 0xC5, 0xCA,
+		0xA5, 0xE3, 0xE5, 0xCB, 0xB0, 0xE0, 0xB5, 0xE4, 0x95, 0xCA, 0xCA, 0x10, 0xF9, 0xB1, 0xE0, 0xA8,
+		0x88, 0xB1, 0xE0, 0x91, 0xE6, 0x98, 0xD0, 0xF8, 0x24, 0xF8, 0x10, 0x09, 0xB5, 0xF7, 0x75, 0xF5,
+		0x95, 0xF7, 0xE8, 0xF0, 0xF7, 0x10, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x14, 0xD0, 0x71, 0x20,
+		0x15, 0xE7, 0xA5, 0xE2, 0x85, 0xE6, 0xA5, 0xE3, 0x85, 0xE7, 0x20, 0x75, 0xE5, 0xA5, 0xE2, 0x85,
+		0xE4, 0xA5, 0xE3, 0x85, 0xE5, 0xD0, 0x0E, 0x20, 0x15, 0xE7, 0x20, 0x6D, 0xE5, 0xA5, 0xE6, 0x85,
+		0xE2, 0xA5, 0xE7, 0x85, 0xE3, 0xA0, 0x00, 0xA5, 0xCA, 0xC5, 0xE4, 0xA5, 0xCB, 0xE5, 0xE5, 0xB0,
+		0x16, 0xA5, 0xE4, 0xD0, 0x02, 0xC6, 0xE5, 0xC6, 0xE4, 0xA5, 0xE6, 0xD0, 0x02, 0xC6, 0xE7, 0xC6,
+		0xE6, 0xB1, 0xE4, 0x91, 0xE6, 0x90, 0xE0, 0xA5, 0xE6, 0x85, 0xCA, 0xA5, 0xE7, 0x85, 0xCB, 0x60,
+		0x20, 0xC9, 0xE3, 0xC8, 0xB9, 0x00, 0xEB, 0x30, 0xF7, 0xC9, 0x8D, 0xD0, 0x06, 0xA9, 0x00, 0x85,
+		0x24, 0xA9, 0x8D, 0xE6, 0x24, 0x2C, 0x12, 0xD0, 0x30, 0xFB, 0x8D, 0x12, 0xD0, 0x60, 0xA0, 0x06,
+		0x20, 0xD3, 0xEE, 0x24, 0xD9, 0x30, 0x03, 0x4C, 0xB6, 0xE2, 0x4C, 0x9A, 0xEB, 0x2A, 0x69, 0xA0,
+		0xDD, 0x00, 0x02, 0xD0, 0x53, 0xB1, 0xFE, 0x0A, 0x30, 0x06, 0x88, 0xB1, 0xFE, 0x30, 0x29, 0xC8,
+		0x86, 0xC8, 0x98, 0x48, 0xA2, 0x00, 0xA1, 0xFE, 0xAA, 0x4A, 0x49, 0x48, 0x11, 0xFE, 0xC9, 0xC0,
+		0x90, 0x01, 0xE8, 0xC8, 0xD0, 0xF3, 0x68, 0xA8, 0x8A, 0x4C, 0xC0, 0xE4, 0xE6, 0xF1, 0xA6, 0xF1,
+		0xF0, 0xBC, 0x9D, 0x00, 0x02, 0x60, 0xA6, 0xC8, 0xA9, 0xA0, 0xE8, 0xDD, 0x00, 0x02, 0xB0, 0xFA,
+		0xB1, 0xFE, 0x29, 0x3F, 0x4A, 0xD0, 0xB6, 0xBD, 0x00, 0x02, 0xB0, 0x06, 0x69, 0x3F, 0xC9, 0x1A,
+		0x90, 0x6F, 0x69, 0x4F, 0xC9, 0x0A, 0x90, 0x69, 0xA6, 0xFD, 0xC8, 0xB1, 0xFE, 0x29, 0xE0, 0xC9,
+		0x20, 0xF0, 0x7A, 0xB5, 0xA8, 0x85, 0xC8, 0xB5, 0xD1, 0x85, 0xF1, 0x88, 0xB1, 0xFE, 0x0A, 0x10,
+		0xFA, 0x88, 0xB0, 0x38, 0x0A, 0x30, 0x35, 0xB4, 0x58, 0x84, 0xFF, 0xB4, 0x80, 0xE8, 0x10, 0xDA,
+		0xF0, 0xB3, 0xC9, 0x7E, 0xB0, 0x22, 0xCA, 0x10, 0x04, 0xA0, 0x06, 0x10, 0x29, 0x94, 0x80, 0xA4,
+		0xFF, 0x94, 0x58, 0xA4, 0xC8, 0x94, 0xA8, 0xA4, 0xF1, 0x94, 0xD1, 0x29, 0x1F, 0xA8, 0xB9, 0x20,
+		0xEC, 0x0A, 0xA8, 0xA9, 0x76, 0x2A, 0x85, 0xFF, 0xD0, 0x01, 0xC8, 0xC8, 0x86, 0xFD, 0xB1, 0xFE,
+		0x30, 0x84, 0xD0, 0x05, 0xA0, 0x0E, 0x4C, 0xE0, 0xE3, 0xC9, 0x03, 0xB0, 0xC3, 0x4A, 0xA6, 0xC8,
+		0xE8, 0xBD, 0x00, 0x02, 0x90, 0x04, 0xC9, 0xA2, 0xF0, 0x0A, 0xC9, 0xDF, 0xF0, 0x06, 0x86, 0xC8,
+		0x20, 0x1C, 0xE4, 0xC8, 0x88, 0xA6, 0xFD, 0xB1, 0xFE, 0x88, 0x0A, 0x10, 0xCF, 0xB4, 0x58, 0x84,
+		0xFF, 0xB4, 0x80, 0xE8, 0xB1, 0xFE, 0x29, 0x9F, 0xD0, 0xED, 0x85, 0xF2, 0x85, 0xF3, 0x98, 0x48,
+		0x86, 0xFD, 0xB4, 0xD0, 0x84, 0xC9, 0x18, 0xA9, 0x0A, 0x85, 0xF9, 0xA2, 0x00, 0xC8, 0xB9, 0x00,
+		0x02, 0x29, 0x0F, 0x65, 0xF2, 0x48, 0x8A, 0x65, 0xF3, 0x30, 0x1C, 0xAA, 0x68, 0xC6, 0xF9, 0xD0,
+		0xF2, 0x85, 0xF2, 0x86, 0xF3, 0xC4, 0xF1, 0xD0, 0xDE, 0xA4, 0xC9, 0xC8, 0x84, 0xF1, 0x20, 0x1C,
+		0xE4, 0x68, 0xA8, 0xA5, 0xF3, 0xB0, 0xA9, 0xA0, 0x00, 0x10, 0x8B, 0x85, 0xF3, 0x86, 0xF2, 0xA2,
+		0x04, 0x86, 0xC9, 0xA9, 0xB0, 0x85, 0xF9, 0xA5, 0xF2, 0xDD, 0x63, 0xE5, 0xA5, 0xF3, 0xFD, 0x68,
+		0xE5, 0x90, 0x0D, 0x85, 0xF3, 0xA5, 0xF2, 0xFD, 0x63, 0xE5, 0x85, 0xF2, 0xE6, 0xF9, 0xD0, 0xE7,
+		0xA5, 0xF9, 0xE8, 0xCA, 0xF0, 0x0E, 0xC9, 0xB0, 0xF0, 0x02, 0x85, 0xC9, 0x24, 0xC9, 0x30, 0x04,
+		0xA5, 0xFA, 0xF0, 0x0B, 0x20, 0xC9, 0xE3, 0x24, 0xF8, 0x10, 0x04, 0x99, 0x00, 0x02, 0xC8, 0xCA,
+		0x10, 0xC1, 0x60, 0x01, 0x0A, 0x64, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x03, 0x27, 0xA5, 0xCA, 0x85,
+		0xE6, 0xA5, 0xCB, 0x85, 0xE7, 0xE8, 0xA5, 0xE7, 0x85, 0xE5, 0xA5, 0xE6, 0x85, 0xE4, 0xC5, 0x4C,
+		0xA5, 0xE5, 0xE5, 0x4D, 0xB0, 0x26, 0xA0, 0x01, 0xB1, 0xE4, 0xE5, 0xCE, 0xC8, 0xB1, 0xE4, 0xE5,
+		0xCF, 0xB0, 0x19, 0xA0, 0x00, 0xA5, 0xE6, 0x71, 0xE4, 0x85, 0xE6, 0x90, 0x03, 0xE6, 0xE7, 0x18,
+		0xC8, 0xA5, 0xCE, 0xF1, 0xE4, 0xC8, 0xA5, 0xCF, 0xF1, 0xE4, 0xB0, 0xCA, 0x60, 0x46, 0xF8, 0xA5,
+		0x4C, 0x85, 0xCA, 0xA5, 0x4D, 0x85, 0xCB, 0xA5, 0x4A, 0x85, 0xCC, 0xA5, 0x4B, 0x85, 0xCD, 0xA9,
+		0x00, 0x85, 0xFB, 0x85, 0xFC, 0x85, 0xFE, 0xA9, 0x00, 0x85, 0x1D, 0x60, 0xA5, 0xD0, 0x69, 0x05,
+		0x85, 0xD2, 0xA5, 0xD1, 0x69, 0x00, 0x85, 0xD3, 0xA5, 0xD2, 0xC5, 0xCA, 0xA5, 0xD3, 0xE5, 0xCB,
+		0x90, 0x03, 0x4C, 0x6B, 0xE3, 0xA5, 0xCE, 0x91, 0xD0, 0xA5, 0xCF, 0xC8, 0x91, 0xD0, 0xA5, 0xD2,
+		0xC8, 0x91, 0xD0, 0xA5, 0xD3, 0xC8, 0x91, 0xD0, 0xA9, 0x00, 0xC8, 0x91, 0xD0, 0xC8, 0x91, 0xD0,
+		0xA5, 0xD2, 0x85, 0xCC, 0xA5, 0xD3, 0x85, 0xCD, 0xA5, 0xD0, 0x90, 0x43, 0x85, 0xCE, 0x84, 0xCF,
+		0x20, 0xFF, 0xE6, 0x30, 0x0E, 0xC9, 0x40, 0xF0, 0x0A, 0x4C, 0x28, 0xE6, 0x06, 0xC9, 0x49, 0xD0,
+		0x07, 0xA9, 0x49, 0x85, 0xCF, 0x20, 0xFF, 0xE6, 0xA5, 0x4B, 0x85, 0xD1, 0xA5, 0x4A, 0x85, 0xD0,
+		0xC5, 0xCC, 0xA5, 0xD1, 0xE5, 0xCD, 0xB0, 0x94, 0xB1, 0xD0, 0xC8, 0xC5, 0xCE, 0xD0, 0x06, 0xB1,
+		0xD0, 0xC5, 0xCF, 0xF0, 0x0E, 0xC8, 0xB1, 0xD0, 0x48, 0xC8, 0xB1, 0xD0, 0x85, 0xD1, 0x68, 0xA0,
+		0x00, 0xF0, 0xDB, 0xA5, 0xD0, 0x69, 0x03, 0x20, 0x0A, 0xE7, 0xA5, 0xD1, 0x69, 0x00, 0x95, 0x78,
+		0xA5, 0xCF, 0xC9, 0x40, 0xD0, 0x1C, 0x88, 0x98, 0x20, 0x0A, 0xE7, 0x88, 0x94, 0x78, 0xA0, 0x03,
+		0xF6, 0x78, 0xC8, 0xB1, 0xD0, 0x30, 0xF9, 0x10, 0x09, 0xA9, 0x00, 0x85, 0xD4, 0x85, 0xD5, 0xA2,
+		0x20, 0x48, 0xA0, 0x00, 0xB1, 0xE0, 0x10, 0x18, 0x0A, 0x30, 0x81, 0x20, 0xFF, 0xE6, 0x20, 0x08,
+		0xE7, 0x20, 0xFF, 0xE6, 0x95, 0xA0, 0x24, 0xD4, 0x10, 0x01, 0xCA, 0x20, 0xFF, 0xE6, 0xB0, 0xE6,
+		0xC9, 0x28, 0xD0, 0x1F, 0xA5, 0xE0, 0x20, 0x0A, 0xE7, 0xA5, 0xE1, 0x95, 0x78, 0x24, 0xD4, 0x30,
+		0x0B, 0xA9, 0x01, 0x20, 0x0A, 0xE7, 0xA9, 0x00, 0x95, 0x78, 0xF6, 0x78, 0x20, 0xFF, 0xE6, 0x30,
+		0xF9, 0xB0, 0xD3, 0x24, 0xD4, 0x10, 0x06, 0xC9, 0x04, 0xB0, 0xD0, 0x46, 0xD4, 0xA8, 0x85, 0xD6,
+		0xB9, 0x98, 0xE9, 0x29, 0x55, 0x0A, 0x85, 0xD7, 0x68, 0xA8, 0xB9, 0x98, 0xE9, 0x29, 0xAA, 0xC5,
+		0xD7, 0xB0, 0x09, 0x98, 0x48, 0x20, 0xFF, 0xE6, 0xA5, 0xD6, 0x90, 0x95, 0xB9, 0x10, 0xEA, 0x85,
+		0xCE, 0xB9, 0x88, 0xEA, 0x85, 0xCF, 0x20, 0xFC, 0xE6, 0x4C, 0xD8, 0xE6, 0x6C, 0xCE, 0x00, 0xE6,
+		0xE0, 0xD0, 0x02, 0xE6, 0xE1, 0xB1, 0xE0, 0x60, 0x94, 0x77, 0xCA, 0x30, 0x03, 0x95, 0x50, 0x60,
+		0xA0, 0x66, 0x4C, 0xE0, 0xE3, 0xA0, 0x00, 0xB5, 0x50, 0x85, 0xCE, 0xB5, 0xA0, 0x85, 0xCF, 0xB5,
+		0x78, 0xF0, 0x0E, 0x85, 0xCF, 0xB1, 0xCE, 0x48, 0xC8, 0xB1, 0xCE, 0x85, 0xCF, 0x68, 0x85, 0xCE,
+		0x88, 0xE8, 0x60, 0x20, 0x4A, 0xE7, 0x20, 0x15, 0xE7, 0x98, 0x20, 0x08, 0xE7, 0x95, 0xA0, 0xC5,
+		0xCE, 0xD0, 0x06, 0xC5, 0xCF, 0xD0, 0x02, 0xF6, 0x50, 0x60, 0x20, 0x82, 0xE7, 0x20, 0x59, 0xE7,
+		0x20, 0x15, 0xE7, 0x24, 0xCF, 0x30, 0x1B, 0xCA, 0x60, 0x20, 0x15, 0xE7, 0xA5, 0xCF, 0xD0, 0x04,
+		0xA5, 0xCE, 0xF0, 0xF3, 0xA9, 0xFF, 0x20, 0x08, 0xE7, 0x95, 0xA0, 0x24, 0xCF, 0x30, 0xE9, 0x20,
+		0x15, 0xE7, 0x98, 0x38, 0xE5, 0xCE, 0x20, 0x08, 0xE7, 0x98, 0xE5, 0xCF, 0x50, 0x23, 0xA0, 0x00,
+		0x10, 0x90, 0x20, 0x6F, 0xE7, 0x20, 0x15, 0xE7, 0xA5, 0xCE, 0x85, 0xDA, 0xA5, 0xCF, 0x85, 0xDB,
+		0x20, 0x15, 0xE7, 0x18, 0xA5, 0xCE, 0x65, 0xDA, 0x20, 0x08, 0xE7, 0xA5, 0xCF, 0x65, 0xDB, 0x70,
+		0xDD, 0x95, 0xA0, 0x60, 0x20, 0x15, 0xE7, 0xA4, 0xCE, 0xF0, 0x05, 0x88, 0xA5, 0xCF, 0xF0, 0x0C,
+		0x60, 0xA5, 0x24, 0x09, 0x07, 0xA8, 0xC8, 0xA9, 0xA0, 0x20, 0xC9, 0xE3, 0xC4, 0x24, 0xB0, 0xF7,
+		0x60, 0x20, 0xB1, 0xE7, 0x20, 0x15, 0xE7, 0xA5, 0xCF, 0x10, 0x0A, 0xA9, 0xAD, 0x20, 0xC9, 0xE3,
+		0x20, 0x72, 0xE7, 0x50, 0xEF, 0x88, 0x84, 0xD5, 0x86, 0xCF, 0xA6, 0xCE, 0x20, 0x1B, 0xE5, 0xA6,
+		0xCF, 0x60, 0x20, 0x15, 0xE7, 0xA5, 0xCE, 0x85, 0xF6, 0xA5, 0xCF, 0x85, 0xF7, 0x88, 0x84, 0xF8,
+		0xC8, 0xA9, 0x0A, 0x85, 0xF4, 0x84, 0xF5, 0x60, 0x20, 0x15, 0xE7, 0xA5, 0xCE, 0xA4, 0xCF, 0x10,
+		0xF2, 0x20, 0x15, 0xE7, 0xB5, 0x50, 0x85, 0xDA, 0xB5, 0x78, 0x85, 0xDB, 0xA5, 0xCE, 0x91, 0xDA,
+		0xC8, 0xA5, 0xCF, 0x91, 0xDA, 0xE8, 0x60, 0x68, 0x68, 0x24, 0xD5, 0x10, 0x05, 0x20, 0xCD, 0xE3,
+		0x46, 0xD5, 0x60, 0xA0, 0xFF, 0x84, 0xD7, 0x60, 0x20, 0xCD, 0xEF, 0xF0, 0x07, 0xA9, 0x25, 0x85,
+		0xD6, 0x88, 0x84, 0xD4, 0xE8, 0x60, 0xA5, 0xCA, 0xA4, 0xCB, 0xD0, 0x5A, 0xA0, 0x41, 0xA5, 0xFC,
+		0xC9, 0x08, 0xB0, 0x5E, 0xA8, 0xE6, 0xFC, 0xA5, 0xE0, 0x99, 0x00, 0x01, 0xA5, 0xE1, 0x99, 0x08,
+		0x01, 0xA5, 0xDC, 0x99, 0x10, 0x01, 0xA5, 0xDD, 0x99, 0x18, 0x01, 0x20, 0x15, 0xE7, 0x20, 0x6D,
+		0xE5, 0x90, 0x04, 0xA0, 0x37, 0xD0, 0x3B, 0xA5, 0xE4, 0xA4, 0xE5, 0x85, 0xDC, 0x84, 0xDD, 0x2C,
+		0x11, 0xD0, 0x30, 0x4F, 0x18, 0x69, 0x03, 0x90, 0x01, 0xC8, 0xA2, 0xFF, 0x86, 0xD9, 0x9A, 0x85,
+		0xE0, 0x84, 0xE1, 0x20, 0x79, 0xE6, 0x24, 0xD9, 0x10, 0x49, 0x18, 0xA0, 0x00, 0xA5, 0xDC, 0x71,
+		0xDC, 0xA4, 0xDD, 0x90, 0x01, 0xC8, 0xC5, 0x4C, 0xD0, 0xD1, 0xC4, 0x4D, 0xD0, 0xCD, 0xA0, 0x34,
+		0x46, 0xD9, 0x4C, 0xE0, 0xE3, 0xA0, 0x4A, 0xA5, 0xFC, 0xF0, 0xF7, 0xC6, 0xFC, 0xA8, 0xB9, 0x0F,
+		0x01, 0x85, 0xDC, 0xB9, 0x17, 0x01, 0x85, 0xDD, 0xBE, 0xFF, 0x00, 0xB9, 0x07, 0x01, 0xA8, 0x8A,
+		0x4C, 0x7A, 0xE8, 0xA0, 0x63, 0x20, 0xC4, 0xE3, 0xA0, 0x01, 0xB1, 0xDC, 0xAA, 0xC8, 0xB1, 0xDC,
+		0x20, 0x1B, 0xE5, 0x4C, 0xB3, 0xE2, 0xC6, 0xFB, 0xA0, 0x5B, 0xA5, 0xFB, 0xF0, 0xC4, 0xA8, 0xB5,
+		0x50, 0xD9, 0x1F, 0x01, 0xD0, 0xF0, 0xB5, 0x78, 0xD9, 0x27, 0x01, 0xD0, 0xE9, 0xB9, 0x2F, 0x01,
+		0x85, 0xDA, 0xB9, 0x37, 0x01, 0x85, 0xDB, 0x20, 0x15, 0xE7, 0xCA, 0x20, 0x93, 0xE7, 0x20, 0x01,
+		0xE8, 0xCA, 0xA4, 0xFB, 0xB9, 0x67, 0x01, 0x95, 0x9F, 0xB9, 0x5F, 0x01, 0xA0, 0x00, 0x20, 0x08,
+		0xE7, 0x20, 0x82, 0xE7, 0x20, 0x59, 0xE7, 0x20, 0x15, 0xE7, 0xA4, 0xFB, 0xA5, 0xCE, 0xF0, 0x05,
+		0x59, 0x37, 0x01, 0x10, 0x12, 0xB9, 0x3F, 0x01, 0x85, 0xDC, 0xB9, 0x47, 0x01, 0x85, 0xDD, 0xBE,
+		0x4F, 0x01, 0xB9, 0x57, 0x01, 0xD0, 0x87, 0xC6, 0xFB, 0x60, 0xA0, 0x54, 0xA5, 0xFB, 0xC9, 0x08,
+		0xF0, 0x9A, 0xE6, 0xFB, 0xA8, 0xB5, 0x50, 0x99, 0x20, 0x01, 0xB5, 0x78, 0x99, 0x28, 0x01, 0x60,
+		0x20, 0x15, 0xE7, 0xA4, 0xFB, 0xA5, 0xCE, 0x99, 0x5F, 0x01, 0xA5, 0xCF, 0x99, 0x67, 0x01, 0xA9,
+		0x01, 0x99, 0x2F, 0x01, 0xA9, 0x00, 0x99, 0x37, 0x01, 0xA5, 0xDC, 0x99, 0x3F, 0x01, 0xA5, 0xDD,
+		0x99, 0x47, 0x01, 0xA5, 0xE0, 0x99, 0x4F, 0x01, 0xA5, 0xE1, 0x99, 0x57, 0x01, 0x60, 0x20, 0x15,
+		0xE7, 0xA4, 0xFB, 0xA5, 0xCE, 0x99, 0x2F, 0x01, 0xA5, 0xCF, 0x4C, 0x66, 0xE9, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0xC0, 0xC0, 0x3C, 0x3C,
+		0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x30, 0x0F, 0xC0, 0xCC, 0xFF, 0x55, 0x00, 0xAB, 0xAB, 0x03, 0x03,
+		0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x55, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xFF, 0x55, 0xC3, 0xC3, 0xC3,
+		0x55, 0xF0, 0xF0, 0xCF, 0x56, 0x56, 0x56, 0x55, 0xFF, 0xFF, 0x55, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0xAB, 0x03, 0x57, 0x03, 0x03, 0x03, 0x03, 0x07, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x17, 0xFF, 0xFF, 0x19, 0x5D, 0x35, 0x4B, 0xF2, 0xEC, 0x87, 0x6F, 0xAD, 0xB7, 0xE2, 0xF8, 0x54,
+		0x80, 0x96, 0x85, 0x82, 0x22, 0x10, 0x33, 0x4A, 0x13, 0x06, 0x0B, 0x4A, 0x01, 0x40, 0x47, 0x7A,
+		0x00, 0xFF, 0x23, 0x09, 0x5B, 0x16, 0xB6, 0xCB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x24, 0xF6, 0x4E,
+		0x59, 0x50, 0x00, 0xFF, 0x23, 0xA3, 0x6F, 0x36, 0x23, 0xD7, 0x1C, 0x22, 0xC2, 0xAE, 0xBA, 0x23,
+		0xFF, 0xFF, 0x21, 0x30, 0x1E, 0x03, 0xC4, 0x20, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xA0, 0x30, 0x1E,
+		0xA4, 0xD3, 0xB6, 0xBC, 0xAA, 0x3A, 0x01, 0x50, 0x7E, 0xD8, 0xD8, 0xA5, 0x3C, 0xFF, 0x16, 0x5B,
+		0x28, 0x03, 0xC4, 0x1D, 0x00, 0x0C, 0x4E, 0x00, 0x3E, 0x00, 0xA6, 0xB0, 0x00, 0xBC, 0xC6, 0x57,
+		0x8C, 0x01, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xE8, 0xE0, 0xE0, 0xE0, 0xEF,
+		0xEF, 0xE3, 0xE3, 0xE5, 0xE5, 0xE7, 0xE7, 0xEE, 0xEF, 0xEF, 0xE7, 0xE7, 0xE2, 0xEF, 0xE7, 0xE7,
+		0xEC, 0xEC, 0xEC, 0xE7, 0xEC, 0xEC, 0xEC, 0xE2, 0x00, 0xFF, 0xE8, 0xE1, 0xE8, 0xE8, 0xEF, 0xEB,
+		0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xEF, 0xEE, 0xEF, 0xE7, 0xE7, 0x00, 0xFF, 0xE8, 0xE7, 0xE7, 0xE7,
+		0xE8, 0xE1, 0xE2, 0xEE, 0xEE, 0xEE, 0xEE, 0xE8, 0xFF, 0xFF, 0xE1, 0xE1, 0xEF, 0xEE, 0xE7, 0xE8,
+		0xEE, 0xE7, 0xFF, 0xFF, 0xFF, 0xEE, 0xE1, 0xEF, 0xE7, 0xE8, 0xEF, 0xEF, 0xEB, 0xE9, 0xE8, 0xE9,
+		0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xFF, 0xE8, 0xE8, 0xE8, 0xEE, 0xE7, 0xE8, 0xEF, 0xEF, 0xEE, 0xEF,
+		0xEE, 0xEF, 0xEE, 0xEE, 0xEF, 0xEE, 0xEE, 0xEE, 0xE1, 0xE8, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xBE, 0xB3, 0xB2, 0xB7, 0xB6, 0x37, 0xD4, 0xCF, 0xCF, 0xA0, 0xCC, 0xCF, 0xCE, 0x47, 0xD3, 0xD9,
+		0xCE, 0xD4, 0xC1, 0x58, 0xCD, 0xC5, 0xCD, 0xA0, 0xC6, 0xD5, 0xCC, 0x4C, 0xD4, 0xCF, 0xCF, 0xA0,
+		0xCD, 0xC1, 0xCE, 0xD9, 0xA0, 0xD0, 0xC1, 0xD2, 0xC5, 0xCE, 0x53, 0xD3, 0xD4, 0xD2, 0xC9, 0xCE,
+		0x47, 0xCE, 0xCF, 0xA0, 0xC5, 0xCE, 0x44, 0xC2, 0xC1, 0xC4, 0xA0, 0xC2, 0xD2, 0xC1, 0xCE, 0xC3,
+		0x48, 0xBE, 0xB8, 0xA0, 0xC7, 0xCF, 0xD3, 0xD5, 0xC2, 0x53, 0xC2, 0xC1, 0xC4, 0xA0, 0xD2, 0xC5,
+		0xD4, 0xD5, 0xD2, 0x4E, 0xBE, 0xB8, 0xA0, 0xC6, 0xCF, 0xD2, 0x53, 0xC2, 0xC1, 0xC4, 0xA0, 0xCE,
+		0xC5, 0xD8, 0x54, 0xD3, 0xD4, 0xCF, 0xD0, 0xD0, 0xC5, 0xC4, 0xA0, 0xC1, 0xD4, 0x20, 0xAA, 0xAA,
+		0xAA, 0x20, 0xA0, 0xC5, 0xD2, 0xD2, 0x0D, 0xBE, 0xB2, 0xB5, 0x35, 0xD2, 0xC1, 0xCE, 0xC7, 0x45,
+		0xC4, 0xC9, 0x4D, 0xD3, 0xD4, 0xD2, 0xA0, 0xCF, 0xD6, 0xC6, 0x4C, 0xDC, 0x0D, 0xD2, 0xC5, 0xD4,
+		0xD9, 0xD0, 0xC5, 0xA0, 0xCC, 0xC9, 0xCE, 0xC5, 0x8D, 0x3F, 0x46, 0xD9, 0x90, 0x03, 0x4C, 0xC3,
+		0xE8, 0xA6, 0xCF, 0x9A, 0xA6, 0xCE, 0xA0, 0x8D, 0xD0, 0x02, 0xA0, 0x99, 0x20, 0xC4, 0xE3, 0x86,
+		0xCE, 0xBA, 0x86, 0xCF, 0xA0, 0xFE, 0x84, 0xD9, 0xC8, 0x84, 0xC8, 0x20, 0x99, 0xE2, 0x84, 0xF1,
+		0xA2, 0x20, 0xA9, 0x30, 0x20, 0x91, 0xE4, 0xE6, 0xD9, 0xA6, 0xCE, 0xA4, 0xC8, 0x0A, 0x85, 0xCE,
+		0xC8, 0xB9, 0x00, 0x02, 0xC9, 0x74, 0xF0, 0xD2, 0x49, 0xB0, 0xC9, 0x0A, 0xB0, 0xF0, 0xC8, 0xC8,
+		0x84, 0xC8, 0xB9, 0x00, 0x02, 0x48, 0xB9, 0xFF, 0x01, 0xA0, 0x00, 0x20, 0x08, 0xE7, 0x68, 0x95,
+		0xA0, 0xA5, 0xCE, 0xC9, 0xC7, 0xD0, 0x03, 0x20, 0x6F, 0xE7, 0x4C, 0x01, 0xE8, 0xFF, 0xFF, 0xFF,
+		0x50, 0x20, 0x13, 0xEC, 0xD0, 0x15, 0x20, 0x0B, 0xEC, 0xD0, 0x10, 0x20, 0x82, 0xE7, 0x20, 0x6F,
+		0xE7, 0x50, 0x03, 0x20, 0x82, 0xE7, 0x20, 0x59, 0xE7, 0x56, 0x50, 0x4C, 0x36, 0xE7, 0xFF, 0xFF,
+		0xC1, 0xFF, 0x7F, 0xD1, 0xCC, 0xC7, 0xCF, 0xCE, 0xC5, 0x9A, 0x98, 0x8B, 0x96, 0x95, 0x93, 0xBF,
+		0xB2, 0x32, 0x2D, 0x2B, 0xBC, 0xB0, 0xAC, 0xBE, 0x35, 0x8E, 0x61, 0xFF, 0xFF, 0xFF, 0xDD, 0xFB,
+		0x20, 0xC9, 0xEF, 0x15, 0x4F, 0x10, 0x05, 0x20, 0xC9, 0xEF, 0x35, 0x4F, 0x95, 0x50, 0x10, 0xCB,
+		0x4C, 0xC9, 0xEF, 0x40, 0x60, 0x8D, 0x60, 0x8B, 0x00, 0x7E, 0x8C, 0x33, 0x00, 0x00, 0x60, 0x03,
+		0xBF, 0x12, 0x00, 0x40, 0x89, 0xC9, 0x47, 0x9D, 0x17, 0x68, 0x9D, 0x0A, 0x00, 0x40, 0x60, 0x8D,
+		0x60, 0x8B, 0x00, 0x7E, 0x8C, 0x3C, 0x00, 0x00, 0x60, 0x03, 0xBF, 0x1B, 0x4B, 0x67, 0xB4, 0xA1,
+		0x07, 0x8C, 0x07, 0xAE, 0xA9, 0xAC, 0xA8, 0x67, 0x8C, 0x07, 0xB4, 0xAF, 0xAC, 0xB0, 0x67, 0x9D,
+		0xB2, 0xAF, 0xAC, 0xAF, 0xA3, 0x67, 0x8C, 0x07, 0xA5, 0xAB, 0xAF, 0xB0, 0xF4, 0xAE, 0xA9, 0xB2,
+		0xB0, 0x7F, 0x0E, 0x27, 0xB4, 0xAE, 0xA9, 0xB2, 0xB0, 0x7F, 0x0E, 0x28, 0xB4, 0xAE, 0xA9, 0xB2,
+		0xB0, 0x64, 0x07, 0xA6, 0xA9, 0x67, 0xAF, 0xB4, 0xAF, 0xA7, 0x78, 0xB4, 0xA5, 0xAC, 0x78, 0x7F,
+		0x02, 0xAD, 0xA5, 0xB2, 0x67, 0xA2, 0xB5, 0xB3, 0xAF, 0xA7, 0xEE, 0xB2, 0xB5, 0xB4, 0xA5, 0xB2,
+		0x7E, 0x8C, 0x39, 0xB4, 0xB8, 0xA5, 0xAE, 0x67, 0xB0, 0xA5, 0xB4, 0xB3, 0x27, 0xAF, 0xB4, 0x07,
+		0x9D, 0x19, 0xB2, 0xAF, 0xA6, 0x7F, 0x05, 0x37, 0xB4, 0xB5, 0xB0, 0xAE, 0xA9, 0x7F, 0x05, 0x28,
+		0xB4, 0xB5, 0xB0, 0xAE, 0xA9, 0x7F, 0x05, 0x2A, 0xB4, 0xB5, 0xB0, 0xAE, 0xA9, 0xE4, 0xAE, 0xA5,
+		0x00, 0xFF, 0xFF, 0x47, 0xA2, 0xA1, 0xB4, 0x7F, 0x0D, 0x30, 0xAD, 0xA9, 0xA4, 0x7F, 0x0D, 0x23,
+		0xAD, 0xA9, 0xA4, 0x67, 0xAC, 0xAC, 0xA1, 0xA3, 0x00, 0x40, 0x80, 0xC0, 0xC1, 0x80, 0x00, 0x47,
+		0x8C, 0x68, 0x8C, 0xDB, 0x67, 0x9B, 0x68, 0x9B, 0x50, 0x8C, 0x63, 0x8C, 0x7F, 0x01, 0x51, 0x07,
+		0x88, 0x29, 0x84, 0x80, 0xC4, 0x80, 0x57, 0x71, 0x07, 0x88, 0x14, 0xED, 0xA5, 0xAD, 0xAF, 0xAC,
+		0xED, 0xA5, 0xAD, 0xA9, 0xA8, 0xF2, 0xAF, 0xAC, 0xAF, 0xA3, 0x71, 0x08, 0x88, 0xAE, 0xA5, 0xAC,
+		0x68, 0x83, 0x08, 0x68, 0x9D, 0x08, 0x71, 0x07, 0x88, 0x60, 0x76, 0xB4, 0xAF, 0xAE, 0x76, 0x8D,
+		0x76, 0x8B, 0x51, 0x07, 0x88, 0x19, 0xB8, 0xA4, 0xAE, 0xB2, 0xF2, 0xB3, 0xB5, 0xF3, 0xA2, 0xA1,
+		0xEE, 0xA7, 0xB3, 0xE4, 0xAE, 0xB2, 0xEB, 0xA5, 0xA5, 0xB0, 0x51, 0x07, 0x88, 0x39, 0x81, 0xC1,
+		0x4F, 0x7F, 0x0F, 0x2F, 0x00, 0x51, 0x06, 0x88, 0x29, 0xC2, 0x0C, 0x82, 0x57, 0x8C, 0x6A, 0x8C,
+		0x42, 0xAE, 0xA5, 0xA8, 0xB4, 0x60, 0xAE, 0xA5, 0xA8, 0xB4, 0x4F, 0x7E, 0x1E, 0x35, 0x8C, 0x27,
+		0x51, 0x07, 0x88, 0x09, 0x8B, 0xFE, 0xE4, 0xAF, 0xAD, 0xF2, 0xAF, 0xE4, 0xAE, 0xA1, 0xDC, 0xDE,
+		0x9C, 0xDD, 0x9C, 0xDE, 0xDD, 0x9E, 0xC3, 0xDD, 0xCF, 0xCA, 0xCD, 0xCB, 0x00, 0x47, 0x9D, 0xAD,
+		0xA5, 0xAD, 0xAF, 0xAC, 0x76, 0x9D, 0xAD, 0xA5, 0xAD, 0xA9, 0xA8, 0xE6, 0xA6, 0xAF, 0x60, 0x8C,
+		0x20, 0xAF, 0xB4, 0xB5, 0xA1, 0xF2, 0xAC, 0xA3, 0xF2, 0xA3, 0xB3, 0x60, 0x8C, 0x20, 0xAC, 0xA5,
+		0xA4, 0xEE, 0xB5, 0xB2, 0x60, 0xAE, 0xB5, 0xB2, 0xF4, 0xB3, 0xA9, 0xAC, 0x60, 0x8C, 0x20, 0xB4,
+		0xB3, 0xA9, 0xAC, 0x7A, 0x7E, 0x9A, 0x22, 0x20, 0x00, 0x60, 0x03, 0xBF, 0x60, 0x03, 0xBF, 0x1F,
+		0x20, 0xB1, 0xE7, 0xE8, 0xE8, 0xB5, 0x4F, 0x85, 0xDA, 0xB5, 0x77, 0x85, 0xDB, 0xB4, 0x4E, 0x98,
+		0xD5, 0x76, 0xB0, 0x09, 0xB1, 0xDA, 0x20, 0xC9, 0xE3, 0xC8, 0x4C, 0x0F, 0xEE, 0xA9, 0xFF, 0x85,
+		0xD5, 0x60, 0xE8, 0xA9, 0x00, 0x95, 0x78, 0x95, 0xA0, 0xB5, 0x77, 0x38, 0xF5, 0x4F, 0x95, 0x50,
+		0x4C, 0x23, 0xE8, 0xFF, 0x20, 0x15, 0xE7, 0xA5, 0xCF, 0xD0, 0x28, 0xA5, 0xCE, 0x60, 0x20, 0x34,
+		0xEE, 0xA4, 0xC8, 0xC9, 0x30, 0xB0, 0x21, 0xC0, 0x28, 0xB0, 0x1D, 0x60, 0xEA, 0xEA, 0x20, 0x34,
+		0xEE, 0x60, 0xEA, 0x8A, 0xA2, 0x01, 0xB4, 0xCE, 0x94, 0x4C, 0xB4, 0x48, 0x94, 0xCA, 0xCA, 0xF0,
+		0xF5, 0xAA, 0x60, 0xA0, 0x77, 0x4C, 0xE0, 0xE3, 0xA0, 0x7B, 0xD0, 0xF9, 0x20, 0x54, 0xE2, 0xA5,
+		0xDA, 0xD0, 0x07, 0xA5, 0xDB, 0xD0, 0x03, 0x4C, 0x7E, 0xE7, 0x06, 0xCE, 0x26, 0xCF, 0x26, 0xE6,
+		0x26, 0xE7, 0xA5, 0xE6, 0xC5, 0xDA, 0xA5, 0xE7, 0xE5, 0xDB, 0x90, 0x0A, 0x85, 0xE7, 0xA5, 0xE6,
+		0xE5, 0xDA, 0x85, 0xE6, 0xE6, 0xCE, 0x88, 0xD0, 0xE1, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x15, 0xE7, 0x6C, 0xCE, 0x00, 0xA5, 0x4C, 0xD0, 0x02, 0xC6, 0x4D, 0xC6, 0x4C, 0xA5, 0x48,
+		0xD0, 0x02, 0xC6, 0x49, 0xC6, 0x48, 0xA0, 0x00, 0xB1, 0x4C, 0x91, 0x48, 0xA5, 0xCA, 0xC5, 0x4C,
+		0xA5, 0xCB, 0xE5, 0x4D, 0x90, 0xE0, 0x4C, 0x53, 0xEE, 0xC9, 0x28, 0xB0, 0x9B, 0xA8, 0xA5, 0xC8,
+		0x60, 0xEA, 0xEA, 0x98, 0xAA, 0xA0, 0x6E, 0x20, 0xC4, 0xE3, 0x8A, 0xA8, 0x20, 0xC4, 0xE3, 0xA0,
+		0x72, 0x4C, 0xC4, 0xE3, 0x20, 0x15, 0xE7, 0x06, 0xCE, 0x26, 0xCF, 0x30, 0xFA, 0xB0, 0xDC, 0xD0,
+		0x04, 0xC5, 0xCE, 0xB0, 0xD6, 0x60, 0x20, 0x15, 0xE7, 0xB1, 0xCE, 0x94, 0x9F, 0x4C, 0x08, 0xE7,
+		0x20, 0x34, 0xEE, 0xA5, 0xCE, 0x48, 0x20, 0x15, 0xE7, 0x68, 0x91, 0xCE, 0x60, 0xFF, 0xFF, 0xFF,
+		0x20, 0x6C, 0xEE, 0xA5, 0xCE, 0x85, 0xE6, 0xA5, 0xCF, 0x85, 0xE7, 0x4C, 0x44, 0xE2, 0x20, 0xE4,
+		0xEE, 0x4C, 0x34, 0xE1, 0x20, 0xE4, 0xEE, 0xB4, 0x78, 0xB5, 0x50, 0x69, 0xFE, 0xB0, 0x01, 0x88,
+		0x85, 0xDA, 0x84, 0xDB, 0x18, 0x65, 0xCE, 0x95, 0x50, 0x98, 0x65, 0xCF, 0x95, 0x78, 0xA0, 0x00,
+		0xB5, 0x50, 0xD1, 0xDA, 0xC8, 0xB5, 0x78, 0xF1, 0xDA, 0xB0, 0x80, 0x4C, 0x23, 0xE8, 0x20, 0x15,
+		0xE7, 0xA5, 0x4E, 0x20, 0x08, 0xE7, 0xA5, 0x4F, 0xD0, 0x04, 0xC5, 0x4E, 0x69, 0x00, 0x29, 0x7F,
+		0x85, 0x4F, 0x95, 0xA0, 0xA0, 0x11, 0xA5, 0x4F, 0x0A, 0x18, 0x69, 0x40, 0x0A, 0x26, 0x4E, 0x26,
+		0x4F, 0x88, 0xD0, 0xF2, 0xA5, 0xCE, 0x20, 0x08, 0xE7, 0xA5, 0xCF, 0x95, 0xA0, 0x4C, 0x7A, 0xE2,
+		0x20, 0x15, 0xE7, 0xA4, 0xCE, 0xC4, 0x4C, 0xA5, 0xCF, 0xE5, 0x4D, 0x90, 0x1F, 0x84, 0x48, 0xA5,
+		0xCF, 0x85, 0x49, 0x4C, 0xB6, 0xEE, 0x20, 0x15, 0xE7, 0xA4, 0xCE, 0xC4, 0xCA, 0xA5, 0xCF, 0xE5,
+		0xCB, 0xB0, 0x09, 0x84, 0x4A, 0xA5, 0xCF, 0x85, 0x4B, 0x4C, 0xB7, 0xE5, 0x4C, 0xCB, 0xEE, 0xEA,
+		0xEA, 0xEA, 0xEA, 0x20, 0xC9, 0xEF, 0x20, 0x71, 0xE1, 0x4C, 0xBF, 0xEF, 0x20, 0x03, 0xEE, 0xA9,
+		0xFF, 0x85, 0xC8, 0xA9, 0x74, 0x8D, 0x00, 0x02, 0x60, 0x20, 0x36, 0xE7, 0xE8, 0x20, 0x36, 0xE7,
+		0xB5, 0x50, 0x60, 0xA9, 0x00, 0x85, 0x4A, 0x85, 0x4C, 0xA9, 0x08, 0x85, 0x4B, 0xA9, 0x10, 0x85,
+		0x4D, 0x4C, 0xAD, 0xE5, 0xD5, 0x78, 0xD0, 0x01, 0x18, 0x4C, 0x02, 0xE1, 0x20, 0xB7, 0xE5, 0x4C,
+		0x36, 0xE8, 0x20, 0xB7, 0xE5, 0x4C, 0x5B, 0xE8, 0xE0, 0x80, 0xD0, 0x01, 0x88, 0x4C, 0x0C, 0xE0
+	};
+
+	// Signetics 2513 character generator, 8 lines per character, pixels right to left
+	static constexpr std::array<uint8_t, 1024> Charmap =
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x00,
+		0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x3E, 0x14, 0x3E, 0x14, 0x14, 0x00,
+		0x08, 0x3C, 0x0A, 0x1C, 0x28, 0x1E, 0x08, 0x00, 0x06, 0x26, 0x10, 0x08, 0x04, 0x32, 0x30, 0x00,
+		0x04, 0x0A, 0x0A, 0x04, 0x2A, 0x12, 0x2C, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00, 0x08, 0x10, 0x20, 0x20, 0x20, 0x10, 0x08, 0x00,
+		0x08, 0x2A, 0x1C, 0x08, 0x1C, 0x2A, 0x08, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00,
+		0x1C, 0x22, 0x32, 0x2A, 0x26, 0x22, 0x1C, 0x00, 0x08, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00,
+		0x1C, 0x22, 0x20, 0x18, 0x04, 0x02, 0x3E, 0x00, 0x3E, 0x20, 0x10, 0x18, 0x20, 0x22, 0x1C, 0x00,
+		0x10, 0x18, 0x14, 0x12, 0x3E, 0x10, 0x10, 0x00, 0x3E, 0x02, 0x1E, 0x20, 0x20, 0x22, 0x1C, 0x00,
+		0x38, 0x04, 0x02, 0x1E, 0x22, 0x22, 0x1C, 0x00, 0x3E, 0x20, 0x10, 0x08, 0x04, 0x04, 0x04, 0x00,
+		0x1C, 0x22, 0x22, 0x1C, 0x22, 0x22, 0x1C, 0x00, 0x1C, 0x22, 0x22, 0x3C, 0x20, 0x10, 0x0E, 0x00,
+		0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x04, 0x00,
+		0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00,
+		0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x00, 0x1C, 0x22, 0x10, 0x08, 0x08, 0x00, 0x08, 0x00,
+		0x1C, 0x22, 0x2C, 0x2A, 0x2A, 0x2A, 0x1C, 0x00, 0x08, 0x14, 0x22, 0x22, 0x3E, 0x22, 0x22, 0x00,
+		0x1E, 0x22, 0x22, 0x1E, 0x22, 0x22, 0x1E, 0x00, 0x1C, 0x22, 0x02, 0x02, 0x02, 0x22, 0x1C, 0x00,
+		0x1E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1E, 0x00, 0x3E, 0x02, 0x02, 0x1E, 0x02, 0x02, 0x3E, 0x00,
+		0x3E, 0x02, 0x02, 0x1E, 0x02, 0x02, 0x02, 0x00, 0x1C, 0x22, 0x02, 0x3A, 0x22, 0x22, 0x1C, 0x00,
+		0x22, 0x22, 0x22, 0x3E, 0x22, 0x22, 0x22, 0x00, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00,
+		0x38, 0x10, 0x10, 0x10, 0x10, 0x12, 0x0C, 0x00, 0x22, 0x12, 0x0A, 0x06, 0x0A, 0x12, 0x22, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3E, 0x00, 0x22, 0x36, 0x2A, 0x2A, 0x22, 0x22, 0x22, 0x00,
+		0x22, 0x22, 0x26, 0x2A, 0x32, 0x22, 0x22, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1C, 0x00,
+		0x1E, 0x22, 0x22, 0x1E, 0x02, 0x02, 0x02, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x2A, 0x12, 0x2C, 0x00,
+		0x1E, 0x22, 0x22, 0x1E, 0x22, 0x22, 0x22, 0x00, 0x1C, 0x22, 0x02, 0x1C, 0x20, 0x22, 0x1C, 0x00,
+		0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1C, 0x00,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x14, 0x08, 0x00, 0x22, 0x22, 0x22, 0x2A, 0x2A, 0x2A, 0x14, 0x00,
+		0x22, 0x22, 0x14, 0x08, 0x14, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x14, 0x08, 0x08, 0x08, 0x00,
+		0x3E, 0x20, 0x10, 0x08, 0x04, 0x02, 0x3E, 0x00, 0x3E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x3E, 0x00,
+		0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00, 0x3E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3E, 0x00,
+		0x00, 0x00, 0x08, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
+		0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x3C, 0x22, 0x3C, 0x00,
+		0x02, 0x02, 0x1E, 0x22, 0x22, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x02, 0x02, 0x02, 0x3C, 0x00,
+		0x20, 0x20, 0x3C, 0x22, 0x22, 0x22, 0x3C, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x3E, 0x02, 0x3C, 0x00,
+		0x18, 0x24, 0x04, 0x1E, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x3C, 0x20, 0x1C,
+		0x02, 0x02, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x00, 0x08, 0x00, 0x0C, 0x08, 0x08, 0x08, 0x1C, 0x00,
+		0x10, 0x00, 0x18, 0x10, 0x10, 0x10, 0x12, 0x0C, 0x02, 0x02, 0x22, 0x12, 0x0E, 0x12, 0x22, 0x00,
+		0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00, 0x00, 0x00, 0x36, 0x2A, 0x2A, 0x2A, 0x22, 0x00,
+		0x00, 0x00, 0x1E, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x1C, 0x00,
+		0x00, 0x00, 0x1E, 0x22, 0x22, 0x1E, 0x02, 0x02, 0x00, 0x00, 0x3C, 0x22, 0x22, 0x3C, 0x20, 0x20,
+		0x00, 0x00, 0x3A, 0x06, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x3C, 0x02, 0x1C, 0x20, 0x1E, 0x00,
+		0x00, 0x04, 0x1E, 0x04, 0x04, 0x24, 0x18, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x32, 0x2C, 0x00,
+		0x00, 0x00, 0x22, 0x22, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00, 0x22, 0x22, 0x2A, 0x2A, 0x36, 0x00,
+		0x00, 0x00, 0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x3C, 0x20, 0x1C,
+		0x00, 0x00, 0x3E, 0x10, 0x08, 0x04, 0x3E, 0x00, 0x38, 0x0C, 0x0C, 0x06, 0x0C, 0x0C, 0x38, 0x00,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E, 0x18, 0x18, 0x30, 0x18, 0x18, 0x0E, 0x00,
+		0x2C, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	};
+};
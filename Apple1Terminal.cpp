@@ -1,5 +1,9 @@
 #include "Apple1Terminal.h"
 
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
 /*
 This implementation of the terminal is not (yet) signal or shift register compliant.
 Reference material:
@@ -8,16 +12,27 @@ https://www.sbprojects.net/projects/apple1/a-one-terminal.php
 */
 
 
-Apple1Terminal::Apple1Terminal(std::shared_ptr<MC6821> pia)
+Apple1Terminal::Apple1Terminal(std::shared_ptr<MC6821> pia, const std::string& sCharmap)
 {
-	// load character ROMs
-	LoadCharacterRom("Apple1_charmap.rom", cCharacterRom, false);
-	LoadCharacterRom("Apple1_charmap.rom", cCharacterRomInverted, true);
+	sink = std::make_shared<Apple1TerminalSink>();
+
+	// character ROMs - embedded unless given as file
+	pCharacterRom = &BuiltinCharacterRom;
+	pCharacterRomInverted = &BuiltinCharacterRomInverted;
+	if (!sCharmap.empty())
+		LoadCharacterRom(sCharmap);
 
 	// wire up with PIA
 	pia->setOutputBHandler([&](uint8_t dsp) {
 		ReceiveOutput(dsp);
 	});
+
+	// PB7 is the display ready line: high while the terminal cannot take another
+	// character, so the CPU waits in its output loop (BIT DSP / BMI) as on the
+	// real machine when the ring is full
+	pia->setInputBHandler([&]() -> uint8_t {
+		return displayQueue.Full() ? 0x80 : 0x00;
+	});
 }
 
 Apple1Terminal::~Apple1Terminal()
@@ -27,9 +42,7 @@ Apple1Terminal::~Apple1Terminal()
 void Apple1Terminal::ClearScreen()
 {
 	// Clear Screen
-	for (int y = 0; y <= sprScreen.height; y++)
-		for (int x = 0; x <= sprScreen.width; x++)
-			sprScreen.SetPixel(x, y, olc::BLACK);
+	sink->Clear();
 
 	for (auto& c : cScreenBuffer)
 		c = ' ';
@@ -39,17 +52,18 @@ void Apple1Terminal::ClearScreen()
 
 bool Apple1Terminal::ProcessOutput()
 {
-	if (displayQueue.empty())
+	uint8_t dsp;
+	if (!displayQueue.Pop(dsp))
 		return false;
 
-	uint8_t dsp = displayQueue.front();
-
 	// make lower case key upper
 	if (dsp >= 0x61 && dsp <= 0x7A)
 		dsp &= 0x5F;
 
+	sink->PutChar(dsp);
+
 	// clear old cursor
-	RenderCharacter(nCursorX, nCursorY, cCharacterRom[cScreenBuffer[nCursorY * nCols + nCursorX]]);
+	RenderCharacter(nCursorX, nCursorY, (*pCharacterRom)[cScreenBuffer[nCursorY * nCols + nCursorX]]);
 
 	// display new character
 	switch (dsp)
@@ -63,7 +77,7 @@ bool Apple1Terminal::ProcessOutput()
 		{
 			cScreenBuffer[nCursorY * nCols + nCursorX] = dsp;
 
-			RenderCharacter(nCursorX, nCursorY, cCharacterRom[dsp]);
+			RenderCharacter(nCursorX, nCursorY, (*pCharacterRom)[dsp]);
 
 			nCursorX++;
 		}
@@ -83,30 +97,33 @@ bool Apple1Terminal::ProcessOutput()
 			for (int x = 0; x < nCols; x++)
 			{
 				cScreenBuffer[y * nCols + x] = cScreenBuffer[(y + 1) * nCols + x];
-				RenderCharacter(x, y, cCharacterRom[cScreenBuffer[y * nCols + x]]);
+				RenderCharacter(x, y, (*pCharacterRom)[cScreenBuffer[y * nCols + x]]);
 			}
 
 		int y = (nRows - 1);
 		for (int x = 0; x < nCols; x++)
 		{
 			cScreenBuffer[y * nCols + x] = ' ';
-			RenderCharacter(x, y, cCharacterRom[cScreenBuffer[y * nCols + x]]);
+			RenderCharacter(x, y, (*pCharacterRom)[cScreenBuffer[y * nCols + x]]);
 		}
 
 		nCursorY--;
 	}
 
 	// draw new cursor
-	RenderCharacter(nCursorX, nCursorY, cCharacterRomInverted[cScreenBuffer[nCursorY * nCols + nCursorX]]);
-
-	displayQueue.pop();
+	RenderCharacter(nCursorX, nCursorY, (*pCharacterRomInverted)[cScreenBuffer[nCursorY * nCols + nCursorX]]);
 
 	return true;
 }
 
-olc::Sprite* Apple1Terminal::getScreenSprite()
+void Apple1Terminal::setSink(std::shared_ptr<Apple1TerminalSink> sink)
 {
-	return &sprScreen;
+	this->sink = sink ? sink : std::make_shared<Apple1TerminalSink>();
+}
+
+size_t Apple1Terminal::getQueueSize()
+{
+	return displayQueue.Size();
 }
 
 uint16_t Apple1Terminal::Width()
@@ -121,73 +138,32 @@ uint16_t Apple1Terminal::Height()
 
 void Apple1Terminal::ReceiveOutput(uint8_t dsp)
 {
-	displayQueue.push(dsp);
+	// written although PB7 signals busy - lost, like on the real terminal
+	displayQueue.Push(dsp);
 }
 
-void Apple1Terminal::LoadCharacterRom(const std::string& sFileName, uint8_t(&rom)[256][8], bool bInvert)
+void Apple1Terminal::LoadCharacterRom(const std::string& sFileName)
 {
 	std::ifstream ifs;
 	std::vector<uint8_t> vMemory;
 
 	ifs.open(sFileName, std::ifstream::binary);
-	if (ifs.is_open())
-	{
-		vMemory.resize(std::filesystem::file_size(sFileName));
-		ifs.read((char*)vMemory.data(), vMemory.size());
+	if (!ifs.is_open())
+		return;
 
-		ifs.close();
-	}
-
-	// feed into character map
-	// flip/reverse bits from right-to-left to left-to-right
-	uint8_t nCharIndex = 0;
-	uint8_t nLineIndex = 0;
-
-	for (int c = 0; c < vMemory.size(); c++)
-	{
-		uint8_t fromMask = 0x80;
-		uint8_t toMask = 0x01;
-		uint8_t bNew = 0;
-		for (int bit = 0; bit < 8; bit++)
-		{
-			if ((vMemory[c] & fromMask) == fromMask) bNew |= toMask;
-			fromMask >>= 1;
-			toMask <<= 1;
-		}
+	vMemory.resize(std::filesystem::file_size(sFileName));
+	ifs.read((char*)vMemory.data(), vMemory.size());
+	ifs.close();
 
-		if (bInvert)
-			rom[nCharIndex][nLineIndex] = ~bNew;
-		else
-			rom[nCharIndex][nLineIndex] = bNew;
+	loadedCharacterRom.reset(new Apple1CharacterRom[2]);
+	loadedCharacterRom[0] = MakeCharacterRom(vMemory.data(), vMemory.size(), false);
+	loadedCharacterRom[1] = MakeCharacterRom(vMemory.data(), vMemory.size(), true);
 
-		nLineIndex++;
-		if (nLineIndex == 8)
-		{
-			nLineIndex = 0;
-			nCharIndex++;
-		}
-	}
+	pCharacterRom = &loadedCharacterRom[0];
+	pCharacterRomInverted = &loadedCharacterRom[1];
 }
 
-void Apple1Terminal::RenderCharacter(uint8_t x, uint8_t y, uint8_t c[])
+void Apple1Terminal::RenderCharacter(uint8_t x, uint8_t y, const std::array<uint8_t, 8>& c)
 {
-	int32_t scanline = y * nCharHeight;
-	int32_t linepos = x * nCharWidth;
-
-	for (int r = 0; r < nCharHeight; r++)
-	{
-		uint8_t mask = c[r];
-		for (int c = nCharWidth; c >= 0; c--, mask >>= 1)
-		{
-			if ((mask & 1) == 1)
-			{
-				sprScreen.SetPixel(linepos + c, scanline + r, olc::DARK_GREEN);
-			}
-			else
-			{
-				sprScreen.SetPixel(linepos + c, scanline + r, olc::BLACK);
-			}
-		}
-	}
+	sink->DrawCell(x, y, c.data());
 }
-
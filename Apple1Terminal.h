@@ -1,16 +1,48 @@
 #pragma once
-#include <queue>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
 
 #include "MC6821.h"
+#include "Apple1Roms.h"
+#include "Apple1TerminalSink.h"
+#include "SpscRing.h"
+
+// character generator as 8 lines per character, pixels left to right
+typedef std::array<std::array<uint8_t, 8>, 256> Apple1CharacterRom;
+
+// flip/reverse bits from right-to-left to left-to-right, optionally inverted for the cursor
+constexpr Apple1CharacterRom MakeCharacterRom(const uint8_t* pCharmap, size_t nSize, bool bInvert)
+{
+	Apple1CharacterRom rom{};
+
+	for (size_t c = 0; c < nSize && c < 256 * 8; c++)
+	{
+		uint8_t bNew = 0;
+		for (int bit = 0; bit < 8; bit++)
+		{
+			if (pCharmap[c] & (0x80 >> bit))
+				bNew |= (uint8_t)(0x01 << bit);
+		}
+
+		rom[c / 8][c % 8] = bInvert ? (uint8_t)~bNew : bNew;
+	}
+
+	return rom;
+}
 
 class Apple1Terminal
 {
 public:
-	Apple1Terminal(std::shared_ptr<MC6821> pia);
+	// sCharmap overrides the embedded character generator
+	Apple1Terminal(std::shared_ptr<MC6821> pia, const std::string& sCharmap = "");
 	~Apple1Terminal();
 	void ClearScreen();
 	bool ProcessOutput();
-	olc::Sprite* getScreenSprite();
+	void setSink(std::shared_ptr<Apple1TerminalSink> sink);
+	// characters received from the PIA, not yet processed
+	size_t getQueueSize();
 
 	static uint16_t Width();
 	static uint16_t Height();
@@ -21,16 +53,21 @@ private:
 	const static uint8_t nCharHeight = 8;
 	const static uint8_t nCharWidth = 8;
 	uint8_t cScreenBuffer[nRows * nCols];
-	uint8_t cCharacterRom[256][8];
-	uint8_t cCharacterRomInverted[256][8];
+	static constexpr Apple1CharacterRom BuiltinCharacterRom = MakeCharacterRom(Apple1Roms::Charmap.data(), Apple1Roms::Charmap.size(), false);
+	static constexpr Apple1CharacterRom BuiltinCharacterRomInverted = MakeCharacterRom(Apple1Roms::Charmap.data(), Apple1Roms::Charmap.size(), true);
+
+	const Apple1CharacterRom* pCharacterRom;
+	const Apple1CharacterRom* pCharacterRomInverted;
+	std::unique_ptr<Apple1CharacterRom[]> loadedCharacterRom;	// normal and inverted from sCharmap
 	uint8_t nCursorY;
 	uint8_t nCursorX;
-	std::queue<uint8_t> displayQueue;
+	// written by the CPU side (PIA), read by ProcessOutput - may be different threads;
+	// when full the PIA reports the display as busy
+	SpscRing<uint8_t, 4096> displayQueue;
 
-	olc::Sprite sprScreen = olc::Sprite(nCols * nCharWidth, nRows * nCharHeight);
+	std::shared_ptr<Apple1TerminalSink> sink;
 
 	void ReceiveOutput(uint8_t dsp);
-	void LoadCharacterRom(const std::string& sFileName, uint8_t(&rom)[256][8], bool bInvert = false);
-	void RenderCharacter(uint8_t x, uint8_t y, uint8_t c[]);
+	void LoadCharacterRom(const std::string& sFileName);
+	void RenderCharacter(uint8_t x, uint8_t y, const std::array<uint8_t, 8>& c);
 };
-
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+/*
+Receives what the Apple1Terminal displays. A frontend implements DrawCell to
+render the character cells into its framebuffer, a headless frontend can simply
+take the character stream from PutChar.
+*/
+
+class Apple1TerminalSink
+{
+public:
+	virtual ~Apple1TerminalSink() {}
+
+	// character as processed by the terminal (upper case, 0x0D = carriage return)
+	virtual void PutChar(uint8_t /*c*/) {}
+
+	// cell x/y now shows glyph - 8 lines of pixels, bit 0 is the leftmost pixel
+	virtual void DrawCell(uint8_t /*x*/, uint8_t /*y*/, const uint8_t* /*glyph*/) {}
+
+	// whole screen was cleared
+	virtual void Clear() {}
+};
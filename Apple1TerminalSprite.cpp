@@ -0,0 +1,79 @@
+#include "Apple1TerminalSprite.h"
+
+Apple1TerminalSprite::Apple1TerminalSprite()
+{
+	uint16_t nCells = (Apple1Terminal::Width() / nCharWidth) * (Apple1Terminal::Height() / nCharHeight);
+	vCellDirty.resize(nCells, false);
+	vDirty.reserve(nCells);
+}
+
+Apple1TerminalSprite::~Apple1TerminalSprite()
+{
+}
+
+olc::Sprite* Apple1TerminalSprite::getScreenSprite()
+{
+	return &sprScreen;
+}
+
+void Apple1TerminalSprite::TakeDirtyCells(std::vector<uint16_t>& vCells)
+{
+	vCells.clear();
+	vCells.swap(vDirty);
+
+	for (auto nCell : vCells)
+		vCellDirty[nCell] = false;
+}
+
+uint8_t Apple1TerminalSprite::CharWidth()
+{
+	return nCharWidth;
+}
+
+uint8_t Apple1TerminalSprite::CharHeight()
+{
+	return nCharHeight;
+}
+
+void Apple1TerminalSprite::MarkDirty(uint16_t nCell)
+{
+	if (!vCellDirty[nCell])
+	{
+		vCellDirty[nCell] = true;
+		vDirty.push_back(nCell);
+	}
+}
+
+void Apple1TerminalSprite::DrawCell(uint8_t x, uint8_t y, const uint8_t* glyph)
+{
+	int32_t scanline = y * nCharHeight;
+	int32_t linepos = x * nCharWidth;
+
+	MarkDirty(y * (Apple1Terminal::Width() / nCharWidth) + x);
+
+	for (int r = 0; r < nCharHeight; r++)
+	{
+		uint8_t mask = glyph[r];
+		for (int c = nCharWidth; c >= 0; c--, mask >>= 1)
+		{
+			if ((mask & 1) == 1)
+			{
+				sprScreen.SetPixel(linepos + c, scanline + r, olc::DARK_GREEN);
+			}
+			else
+			{
+				sprScreen.SetPixel(linepos + c, scanline + r, olc::BLACK);
+			}
+		}
+	}
+}
+
+void Apple1TerminalSprite::Clear()
+{
+	for (int y = 0; y <= sprScreen.height; y++)
+		for (int x = 0; x <= sprScreen.width; x++)
+			sprScreen.SetPixel(x, y, olc::BLACK);
+
+	for (uint16_t nCell = 0; nCell < vCellDirty.size(); nCell++)
+		MarkDirty(nCell);
+}
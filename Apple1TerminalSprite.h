@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+
+#include "Apple1Terminal.h"
+#include "olcPixelGameEngine.h"
+
+/*
+Renders the Apple1Terminal character cells into a olc::Sprite for the
+olcPixelGameEngine frontend. Cells drawn since the frontend last asked are
+remembered, so it only needs to copy those to the screen.
+*/
+
+class Apple1TerminalSprite : public Apple1TerminalSink
+{
+public:
+	Apple1TerminalSprite();
+	~Apple1TerminalSprite();
+
+	olc::Sprite* getScreenSprite();
+
+	// cells changed since the last call, as index y * columns + x, swapped into vCells
+	void TakeDirtyCells(std::vector<uint16_t>& vCells);
+
+	static uint8_t CharWidth();
+	static uint8_t CharHeight();
+
+	void DrawCell(uint8_t x, uint8_t y, const uint8_t* glyph) override;
+	void Clear() override;
+
+private:
+	const static uint8_t nCharHeight = 8;
+	const static uint8_t nCharWidth = 8;
+
+	olc::Sprite sprScreen = olc::Sprite(Apple1Terminal::Width(), Apple1Terminal::Height());
+
+	std::vector<bool> vCellDirty;
+	std::vector<uint16_t> vDirty;
+
+	void MarkDirty(uint16_t nCell);
+};
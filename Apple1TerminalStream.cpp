@@ -0,0 +1,19 @@
+#include "Apple1TerminalStream.h"
+
+Apple1TerminalStream::Apple1TerminalStream(std::ostream& os) :
+	os{ os }
+{
+}
+
+Apple1TerminalStream::~Apple1TerminalStream()
+{
+	os.flush();
+}
+
+void Apple1TerminalStream::PutChar(uint8_t c)
+{
+	if (c == 0x0D)
+		os.put('\n');
+	else if (c >= 0x20 && c <= 0x5F)
+		os.put((char)c);
+}
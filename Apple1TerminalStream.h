@@ -0,0 +1,21 @@
+#pragma once
+#include <ostream>
+
+#include "Apple1TerminalSink.h"
+
+/*
+Writes the Apple1Terminal output to a stream (e.g. stdout), carriage return
+becomes '\n'.
+*/
+
+class Apple1TerminalStream : public Apple1TerminalSink
+{
+public:
+	Apple1TerminalStream(std::ostream& os);
+	~Apple1TerminalStream();
+
+	void PutChar(uint8_t c) override;
+
+private:
+	std::ostream& os;
+};
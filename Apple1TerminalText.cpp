@@ -0,0 +1,27 @@
+#include "Apple1TerminalText.h"
+
+Apple1TerminalText::Apple1TerminalText()
+{
+}
+
+Apple1TerminalText::~Apple1TerminalText()
+{
+}
+
+const std::string& Apple1TerminalText::getText()
+{
+	return sText;
+}
+
+void Apple1TerminalText::ClearText()
+{
+	sText.clear();
+}
+
+void Apple1TerminalText::PutChar(uint8_t c)
+{
+	if (c == 0x0D)
+		sText += '\n';
+	else if (c >= 0x20 && c <= 0x5F)
+		sText += (char)c;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+
+#include "Apple1TerminalSink.h"
+
+/*
+Collects the Apple1Terminal output as plain text, carriage return becomes '\n'.
+*/
+
+class Apple1TerminalText : public Apple1TerminalSink
+{
+public:
+	Apple1TerminalText();
+	~Apple1TerminalText();
+
+	const std::string& getText();
+	void ClearText();
+
+	void PutChar(uint8_t c) override;
+
+private:
+	std::string sText;
+};
@@ -0,0 +1,252 @@
+#include "BatchRunner.h"
+#include "ParseNumber.h"
+#include "WorkStealingPool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+BatchRunner::BatchRunner(size_t nThreads, const Apple1Config& config) :
+	nThreads{ nThreads }, config{ config }
+{
+}
+
+BatchRunner::~BatchRunner()
+{
+}
+
+std::vector<BatchResult> BatchRunner::Run(const std::vector<BatchJob>& vJobs)
+{
+	std::vector<BatchResult> vResults(vJobs.size());
+
+	WorkStealingPool pool(nThreads);
+
+	for (size_t i = 0; i < vJobs.size(); i++)
+	{
+		pool.Submit([this, &vJobs, &vResults, i]() {
+			vResults[i] = RunJob(vJobs[i], config);
+		});
+	}
+
+	pool.Wait();
+
+	return vResults;
+}
+
+BatchResult BatchRunner::RunJob(const BatchJob& job, const Apple1Config& config)
+{
+	BatchResult result;
+	result.sName = job.sName;
+
+	auto tStart = std::chrono::steady_clock::now();
+
+	Apple1Machine machine(config);
+	machine.Reset();
+	machine.kbd->setKeyDelay(job.nKeyDelay);
+	if (!job.sLoadFile.empty())
+		machine.Load(job.sLoadFile);
+	if (job.bRunOverride)
+		machine.RunAt(job.nRunAddress);
+	machine.TypeText(job.sInput);
+	result.nExit = machine.Run(job.nCycleBudget);
+
+	auto tEnd = std::chrono::steady_clock::now();
+
+	result.sOutput = machine.getOutput();
+	result.nCycles = machine.getCycles();
+	result.fSeconds = std::chrono::duration<double>(tEnd - tStart).count();
+
+	return result;
+}
+
+uint64_t BatchRunner::HashOutput(const std::string& sOutput)
+{
+	// FNV-1a
+	uint64_t h = 0xCBF29CE484222325ULL;
+	for (unsigned char c : sOutput)
+	{
+		h ^= c;
+		h *= 0x100000001B3ULL;
+	}
+	return h;
+}
+
+int BatchRunner::Main(const std::vector<std::string>& vArgs, const Apple1Config& config)
+{
+	size_t nThreads = 0;
+	uint64_t nCycleBudget = 100000000; // ~100s of Apple 1 time
+	uint32_t nKeyDelay = 0;
+	std::string sLoadFile;
+	bool bRunOverride = false;
+	uint16_t nRunAddress = 0x0000;
+	std::string sOutDir;
+	std::string sGoldenFile;
+	std::vector<BatchJob> vJobs;
+
+	const char* sUsage = "usage: --batch [-j threads] [-c cycles] [-k keydelay] [-l file[@addr]] [-r addr] [-o outdir] [-g golden] input files...";
+
+	for (size_t i = 0; i < vArgs.size(); i++)
+	{
+		const std::string& a = vArgs[i];
+		uint64_t n = 0;
+		bool bValid = true;
+
+		if (a == "-j" && i + 1 < vArgs.size())
+		{
+			bValid = ParseNumber(vArgs[++i], n);
+			nThreads = (size_t)n;
+		}
+		else if (a == "-c" && i + 1 < vArgs.size())
+			bValid = ParseNumber(vArgs[++i], nCycleBudget);
+		else if (a == "-k" && i + 1 < vArgs.size())
+		{
+			bValid = ParseNumber(vArgs[++i], n, 10, UINT32_MAX);
+			nKeyDelay = (uint32_t)n;
+		}
+		else if (a == "-l" && i + 1 < vArgs.size())
+			sLoadFile = vArgs[++i];
+		else if (a == "-r" && i + 1 < vArgs.size())
+		{
+			bRunOverride = true;
+			bValid = ParseAddress(vArgs[++i], nRunAddress);
+		}
+		else if (a == "-o" && i + 1 < vArgs.size())
+			sOutDir = vArgs[++i];
+		else if (a == "-g" && i + 1 < vArgs.size())
+			sGoldenFile = vArgs[++i];
+		else
+		{
+			std::ifstream ifs(a, std::ifstream::binary);
+			if (!ifs.is_open())
+			{
+				std::cerr << "cannot open batch input " << a << std::endl;
+				return 1;
+			}
+
+			std::stringstream ss;
+			ss << ifs.rdbuf();
+
+			BatchJob job;
+			job.sName = a;
+			job.sInput = ss.str();
+			vJobs.push_back(job);
+		}
+
+		if (!bValid)
+		{
+			std::cerr << "invalid value " << vArgs[i] << " for " << a << std::endl;
+			std::cerr << sUsage << std::endl;
+			return 1;
+		}
+	}
+
+	if (vJobs.empty())
+	{
+		std::cerr << sUsage << std::endl;
+		return 1;
+	}
+
+	// expected exit, cycles and output hash per job file name
+	std::map<std::string, std::string> mapGolden;
+	if (!sGoldenFile.empty())
+	{
+		std::ifstream ifs(sGoldenFile);
+		if (!ifs.is_open())
+		{
+			std::cerr << "cannot open golden file " << sGoldenFile << std::endl;
+			return 1;
+		}
+
+		std::string sLine;
+		while (std::getline(ifs, sLine))
+		{
+			if (!sLine.empty() && sLine.back() == '\r')
+				sLine.pop_back();
+			if (sLine.empty() || sLine[0] == '#')
+				continue;
+
+			size_t nTab = sLine.find('\t');
+			if (nTab != std::string::npos)
+				mapGolden[GoldenKey(sLine.substr(0, nTab))] = sLine.substr(nTab + 1);
+		}
+	}
+
+	for (auto& job : vJobs)
+	{
+		job.nCycleBudget = nCycleBudget;
+		job.nKeyDelay = nKeyDelay;
+		job.sLoadFile = sLoadFile;
+		job.bRunOverride = bRunOverride;
+		job.nRunAddress = nRunAddress;
+	}
+
+	BatchRunner runner(nThreads, config);
+
+	auto tStart = std::chrono::steady_clock::now();
+	auto vResults = runner.Run(vJobs);
+	auto tEnd = std::chrono::steady_clock::now();
+	double fSeconds = std::chrono::duration<double>(tEnd - tStart).count();
+
+	uint64_t nTotalCycles = 0;
+	size_t nFailed = 0;
+	for (const auto& r : vResults)
+	{
+		nTotalCycles += r.nCycles;
+
+		char sHash[17];
+		snprintf(sHash, sizeof(sHash), "%016llx", (unsigned long long)HashOutput(r.sOutput));
+
+		std::string sResult = std::string(Apple1Machine::ExitReasonName(r.nExit)) + "\t" + std::to_string(r.nCycles) + "\t" + sHash;
+
+		std::cout << r.sName << "\t" << sResult << "\t" << r.fSeconds << "\t"
+			<< (r.fSeconds > 0 ? r.nCycles / r.fSeconds / 1e6 : 0);
+
+		if (!sGoldenFile.empty())
+		{
+			auto it = mapGolden.find(GoldenKey(r.sName));
+			if (it == mapGolden.end())
+			{
+				std::cout << "\tFAIL no golden result";
+				nFailed++;
+			}
+			else if (it->second != sResult)
+			{
+				std::cout << "\tFAIL expected " << it->second;
+				nFailed++;
+			}
+			else
+				std::cout << "\tok";
+		}
+
+		std::cout << std::endl;
+
+		if (!sOutDir.empty())
+		{
+			std::filesystem::path p = std::filesystem::path(sOutDir) / std::filesystem::path(r.sName).filename();
+			p += ".out";
+			std::ofstream ofs(p, std::ofstream::binary);
+			ofs << r.sOutput;
+		}
+	}
+
+	std::cout << "# " << vResults.size() << " jobs, " << nTotalCycles << " cycles, "
+		<< fSeconds << " s, " << (fSeconds > 0 ? nTotalCycles / fSeconds / 1e6 : 0) << " emulated MHz" << std::endl;
+
+	if (nFailed > 0)
+	{
+		std::cout << "# " << nFailed << " of " << vResults.size() << " jobs diverge from " << sGoldenFile << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+std::string BatchRunner::GoldenKey(const std::string& sName)
+{
+	// jobs are matched by file name, independent of the directory they are run from
+	return std::filesystem::path(sName).filename().string();
+}
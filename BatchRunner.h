@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Apple1Machine.h"
+
+/*
+Runs many independent Apple 1 machines, each with scripted keyboard input and a
+cycle budget, distributed over a work stealing thread pool.
+*/
+
+struct BatchJob
+{
+	std::string sName;
+	std::string sInput;
+	uint64_t nCycleBudget = 0;
+	uint32_t nKeyDelay = 0;
+	std::string sLoadFile;		// see ProgramLoader::LoadFile
+	bool bRunOverride = false;
+	uint16_t nRunAddress = 0x0000;
+};
+
+struct BatchResult
+{
+	std::string sName;
+	std::string sOutput;
+	Apple1Machine::ExitReason nExit = Apple1Machine::ExitReason::CycleBudget;
+	uint64_t nCycles = 0;
+	double fSeconds = 0.0;
+};
+
+class BatchRunner
+{
+public:
+	BatchRunner(size_t nThreads = 0, const Apple1Config& config = Apple1Config());
+	~BatchRunner();
+
+	std::vector<BatchResult> Run(const std::vector<BatchJob>& vJobs);
+
+	static uint64_t HashOutput(const std::string& sOutput);
+
+	// command line entry: [-j threads] [-c cycles] [-k keydelay] [-l file[@addr]] [-r addr] [-o outdir] [-g golden] input files...
+	// with -g every job must match its line "name exit cycles hash" of the golden file, otherwise 1 is returned
+	static int Main(const std::vector<std::string>& vArgs, const Apple1Config& config = Apple1Config());
+
+private:
+	size_t nThreads;
+	Apple1Config config;
+
+	static BatchResult RunJob(const BatchJob& job, const Apple1Config& config);
+	static std::string GoldenKey(const std::string& sName);
+};
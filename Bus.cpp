@@ -3,35 +3,54 @@
 #include "MC6821.h"
 
 
-Bus::Bus()
+Bus::Bus(const Apple1Config& config)
 {
 	cpu = std::make_shared<olc6502>();
 	pia = std::make_shared<MC6821>();
 
+	nRefresh = config.nRefresh;
+	nOpenBus = config.nOpenBus;
+	bOpenBusHigh = config.bOpenBusHigh;
+
+	if (!config.sAciRom.empty())
+		aci = std::make_shared<Apple1Aci>(config);
+	if (!config.sCffa1Dir.empty())
+		cffa1 = std::make_shared<Apple1Cffa1>(config);
+	if (config.nSerialBase != 0)
+		acia = std::make_shared<MOS6551>();
+	nNextRefresh = nLineCpuCycles;
+
 	// Clear RAM contents, just in case :P
 	for (auto& i : ram) i = 0x00;
 
 	// load the cartridges & set Reset Vector
-#ifdef TESTROM
-	auto rom = std::make_shared<Rom>("6502_functional_test.bin", 0x0000);
-
-	for (uintmax_t addr = 0x0000; addr <= 0xFFFF; addr++)
+	for (auto& image : config.vRoms)
 	{
-		uint8_t data = 0x00;
-		rom->cpuRead(addr, data);
-		ram[addr] = data;
+		if (image.pBuiltin)
+			roms.push_back(std::make_shared<Rom>(image.pBuiltin, image.nBuiltinSize, image.nOffset));
+		else
+			roms.push_back(std::make_shared<Rom>(image.sFileName, image.nOffset));
 	}
 
-	ram[0xFFFC] = 0x00;
-	ram[0xFFFD] = 0x04;
+	// RAM images, e.g. the functional test ROM
+	for (auto& image : config.vImages)
+	{
+		auto rom = image.pBuiltin ?
+			std::make_shared<Rom>(image.pBuiltin, image.nBuiltinSize, image.nOffset) :
+			std::make_shared<Rom>(image.sFileName, image.nOffset);
+
+		for (uintmax_t addr = rom->Low(); addr <= rom->High() && rom->ImageValid(); addr++)
+		{
+			uint8_t data = 0x00;
+			rom->cpuRead((uint16_t)addr, data);
+			ram[addr] = data;
+		}
+	}
 
-#else
-	roms.push_back(std::make_shared<Rom>("Apple1_HexMonitor.rom", 0xFF00));
-	roms.push_back(std::make_shared<Rom>("Apple1_basic.rom", 0xE000));
+	ram[0xFFFC] = config.nResetVector & 0xFF;
+	ram[0xFFFD] = config.nResetVector >> 8;
 
-	ram[0xFFFC] = 0x00;
-	ram[0xFFFD] = 0xFF;
-#endif
+	BuildMap(config);
 
 	// Connect CPU to communication bus
 	cpu->ConnectBus(this);
@@ -44,8 +63,10 @@ Bus::~Bus()
 
 void Bus::reset()
 {
+	// the video timing, and with it the refresh, keeps running through a reset
 	cpu->reset();
-	nSystemClockCounter = 0;
+	if (acia)
+		acia->reset();
 }
 
 void Bus::clock()
@@ -54,52 +75,241 @@ void Bus::clock()
 	nSystemClockCounter++;
 }
 
-void Bus::cpuWrite(uint16_t addr, uint8_t data)
+void Bus::clockExact()
 {
-#ifdef TESTROM
-#else
-	for (auto r : roms)
+	cpu->clock();
+	nSystemClockCounter++;
+
+	if (nSystemClockCounter == nNextRefresh)
 	{
-		if (r->cpuWrite(addr, data))
-			return;
+		nNextRefresh += nLineCpuCycles;
+		nRefreshTicks += nRefreshStretch;
 	}
+}
 
-	if (addr >= 0xD010 && addr <= 0xD01F)
+bool Bus::IsRefreshExact()
+{
+	return nRefresh == Apple1Config::Refresh::Exact;
+}
+
+uint64_t Bus::getClockTicks()
+{
+	switch (nRefresh)
 	{
-		pia->cpuWrite(addr, data);
+	case Apple1Config::Refresh::Batch:
+		return nSystemClockCounter + nSystemClockCounter * nRefreshStretch / nLineCpuCycles;
+	case Apple1Config::Refresh::Exact:
+		return nSystemClockCounter + nRefreshTicks;
+	default:
+		return nSystemClockCounter;
 	}
+}
+
+void Bus::cpuWrite(uint16_t addr, uint8_t data)
+{
+	const Page& page = vPages[addr >> 8];
+	if (page.pWrite)
+		page.pWrite[addr & 0xFF] = data;
 	else
-#endif
-		if (addr >= 0x0000 && addr <= 0xFFFF)
-		{
-			ram[addr] = data;
-		}
+		SlotWrite(addr, data);
 }
 
 uint8_t Bus::cpuRead(uint16_t addr, bool bReadOnly)
 {
+	const Page& page = vPages[addr >> 8];
+	if (page.pRead)
+		return page.pRead[addr & 0xFF];
+
+	return SlotRead(addr, bReadOnly);
+}
+
+uint8_t Bus::SlotRead(uint16_t addr, bool bReadOnly)
+{
+	const Slot& slot = vSlots[addr];
 	uint8_t data = 0x00;
 
-#ifdef TESTROM
-#else
-	for (auto r : roms)
+	switch (slot.nTarget)
+	{
+	case Target::Ram:
+	case Target::ReadOnly:
+		data = ram[slot.nAddr];
+		break;
+	case Target::Rom:
+		roms[slot.nRom]->cpuRead(slot.nAddr, data);
+		break;
+	case Target::Pia:
+		data = pia->cpuRead(slot.nAddr, bReadOnly);
+		break;
+	case Target::Aci:
+		data = aci->cpuRead(slot.nAddr, getClockTicks(), bReadOnly);
+		break;
+	case Target::Cffa1:
+		data = cffa1->cpuRead(slot.nAddr);
+		break;
+	case Target::Acia:
+		data = acia->cpuRead(slot.nAddr, bReadOnly);
+		break;
+	default:
+		data = bOpenBusHigh ? (uint8_t)(addr >> 8) : nOpenBus;
+		break;
+	}
+
+	return data;
+}
+
+void Bus::SlotWrite(uint16_t addr, uint8_t data)
+{
+	const Slot& slot = vSlots[addr];
+
+	switch (slot.nTarget)
+	{
+	case Target::Ram:
+		ram[slot.nAddr] = data;
+		break;
+	case Target::Rom:
 	{
-		if (r->cpuRead(addr, data))
-			return data;
+		// the image is copied on the first write, its pages point to the copy then
+		auto& rom = roms[slot.nRom];
+		const uint8_t* pBefore = rom->Pointer(slot.nAddr);
+		rom->cpuWrite(slot.nAddr, data);
+		if (rom->Pointer(slot.nAddr) != pBefore)
+		{
+			for (uint32_t nPage = 0; nPage < 256; nPage++)
+				BuildPage((uint8_t)nPage);
+		}
+		break;
+	}
+	case Target::Pia:
+		pia->cpuWrite(slot.nAddr, data);
+		break;
+	case Target::Aci:
+		aci->cpuWrite(slot.nAddr, getClockTicks());
+		break;
+	case Target::Cffa1:
+		cffa1->cpuWrite(slot.nAddr, data);
+		break;
+	case Target::Acia:
+		acia->cpuWrite(slot.nAddr, data);
+		break;
+	default:
+		// read only and unmapped
+		break;
 	}
+}
+
+void Bus::BuildMap(const Apple1Config& config)
+{
+	vSlots.assign(64 * 1024, Slot());
+
+	auto Fill = [this](uint32_t nStart, uint32_t nEnd, Target nTarget)
+	{
+		for (uint32_t addr = nStart; addr <= nEnd; addr++)
+			vSlots[addr] = { nTarget, 0, (uint16_t)addr };
+	};
 
-	if (addr >= 0xD010 && addr <= 0xD01F)
+	// populated RAM from $0000, the declared regions over it
+	Fill(0x0000, config.nRamSize - 1, Target::Ram);
+
+	for (auto& region : config.vMap)
 	{
-		data = pia->cpuRead(addr);
+		if (region.nKind == MemoryRegion::Kind::Ram)
+			Fill(region.nStart, region.nEnd, Target::Ram);
+		else if (region.nKind == MemoryRegion::Kind::ReadOnly)
+			Fill(region.nStart, region.nEnd, Target::ReadOnly);
+		else if (region.nKind == MemoryRegion::Kind::Open)
+			Fill(region.nStart, region.nEnd, Target::Open);
 	}
-	else
-#endif
-		if (addr >= 0x0000 && addr <= 0xFFFF)
+
+	// devices and ROMs on top, the one decoded first on the real machine last. A device
+	// is selected where the address lines in nSelectMask match nSelect and sees
+	// nBase + the lines in nRegisterMask, so partial decoding repeats its registers
+	// here once instead of comparing addresses on every access.
+	struct DeviceWindow
+	{
+		bool bPresent;
+		Target nTarget;
+		uint16_t nStart;
+		uint16_t nEnd;
+		uint16_t nSelectMask;
+		uint16_t nSelect;
+		uint16_t nRegisterMask;
+		uint16_t nBase;
+	};
+
+	const DeviceWindow vWindows[] =
+	{
+		{ acia != nullptr, Target::Acia, config.nSerialBase, (uint16_t)(config.nSerialBase + 0x0F), 0x0000, 0x0000, 0x000F, config.nSerialBase },
+		{ cffa1 != nullptr, Target::Cffa1, 0x9000, 0xAFFF, 0x0000, 0x0000, 0xFFFF, 0x9000 },
+		{ aci != nullptr, Target::Aci, 0xC000, 0xC1FF, 0x0000, 0x0000, 0x01FF, 0xC000 },
+		// the 74154 selects the $Dxxx block, the PIA decodes only A4 (chip select) and
+		// A0/A1 (register select) - $D010-$D013 repeat wherever A4 is set in the block
+		{ config.bPia, Target::Pia, 0xD000, 0xDFFF, 0x0010, 0x0010, 0x0003, 0xD010 }
+	};
+
+	for (auto& window : vWindows)
+	{
+		if (!window.bPresent)
+			continue;
+
+		for (uint32_t addr = window.nStart; addr <= window.nEnd; addr++)
 		{
-			data = ram[addr];
+			if ((addr & window.nSelectMask) == window.nSelect)
+				vSlots[addr] = { window.nTarget, 0, (uint16_t)(window.nBase + ((addr - window.nStart) & window.nRegisterMask)) };
 		}
+	}
 
-	return data;
+	for (size_t i = roms.size(); i-- > 0;)
+	{
+		if (!roms[i]->ImageValid())
+			continue;
+
+		for (uint32_t addr = roms[i]->Low(); addr <= 0xFFFF && roms[i]->Pointer((uint16_t)addr); addr++)
+			vSlots[addr] = { Target::Rom, (uint8_t)i, (uint16_t)addr };
+	}
+
+	// mirrors last, so they repeat whatever their source resolved to
+	for (auto& region : config.vMap)
+	{
+		if (region.nKind != MemoryRegion::Kind::Mirror)
+			continue;
+
+		std::vector<Slot> vSource(vSlots.begin() + region.nSourceStart, vSlots.begin() + region.nSourceEnd + 1);
+		for (uint32_t addr = region.nStart; addr <= region.nEnd; addr++)
+			vSlots[addr] = vSource[(addr - region.nStart) % vSource.size()];
+	}
+
+	for (uint32_t nPage = 0; nPage < 256; nPage++)
+		BuildPage((uint8_t)nPage);
+}
+
+void Bus::BuildPage(uint8_t nPage)
+{
+	Page& page = vPages[nPage];
+	page = Page();
+
+	// one kind of memory, contiguous from the first slot
+	const Slot* pSlots = &vSlots[nPage << 8];
+	for (uint32_t i = 1; i < 256; i++)
+	{
+		if (pSlots[i].nTarget != pSlots[0].nTarget || pSlots[i].nRom != pSlots[0].nRom || pSlots[i].nAddr != pSlots[0].nAddr + i)
+			return;
+	}
+
+	switch (pSlots[0].nTarget)
+	{
+	case Target::Ram:
+		page.pRead = &ram[pSlots[0].nAddr];
+		page.pWrite = &ram[pSlots[0].nAddr];
+		break;
+	case Target::ReadOnly:
+		page.pRead = &ram[pSlots[0].nAddr];
+		break;
+	case Target::Rom:
+		page.pRead = roms[pSlots[0].nRom]->Pointer(pSlots[0].nAddr);
+		break;
+	default:
+		break;
+	}
 }
 
 uint16_t Bus::RomLow()
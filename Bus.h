@@ -1,23 +1,34 @@
 #pragma once
 #include <cstdint>
 #include <array>
+#include <memory>
+#include <vector>
 
 #include "olc6502.h"
 #include "MC6821.h"
+#include "MOS6551.h"
+#include "Apple1Aci.h"
+#include "Apple1Cffa1.h"
 #include "Rom.h"
+#include "Apple1Config.h"
 
 class Bus
 {
 public:
-	Bus();
+	Bus(const Apple1Config& config = Apple1Config());
 	~Bus();
 
 public: // Devices on bus
 	std::shared_ptr<olc6502> cpu;
 	std::shared_ptr<MC6821> pia;
+	std::shared_ptr<Apple1Aci> aci;		// nullptr without aci = file
+	std::shared_ptr<Apple1Cffa1> cffa1;	// nullptr without cffa1 = dir
+	std::shared_ptr<MOS6551> acia;		// serial card, nullptr without serial = addr
 
-	std::list<std::shared_ptr<Rom>> roms;
+	std::vector<std::shared_ptr<Rom>> roms;
 
+	// store of the RAM regions, indexed by address - loaders write here directly,
+	// the CPU only sees the parts the memory map shows
 	std::array<uint8_t, 64 * 1024> ram;
 
 
@@ -27,15 +38,75 @@ public: // Bus Read & Write
 	uint16_t RomLow();
 	uint16_t RomHigh();
 
+public: // DRAM refresh
+	// Master clock ticks passed: the CPU cycles plus the ticks the clock was held
+	// for DRAM refresh. The Apple 1 refreshes its DRAM in the horizontal blanking,
+	// nRefreshStretch ticks of every nLineCycles tick scan line, so the CPU gets
+	// nLineCpuCycles of each line, about 960 kHz of the 1.023 MHz clock.
+	uint64_t getClockTicks();
+
+	const static uint32_t nLineCycles = 65;
+	const static uint32_t nRefreshStretch = 4;
+	const static uint32_t nLineCpuCycles = nLineCycles - nRefreshStretch;
+
 private:
 	// A count of how many clocks have passed
-	uint32_t nSystemClockCounter = 0;
+	uint64_t nSystemClockCounter = 0;
+
+	// Memory map, compiled once from the configuration by BuildMap: every address
+	// resolves to a slot, mirrors to the slot of their source. Pages of one kind of
+	// memory get direct pointers, so RAM and ROM take one lookup and no compares;
+	// only pages holding devices or mixed slots go through the slots.
+	enum class Target : uint8_t
+	{
+		Open,
+		Ram,
+		ReadOnly,
+		Rom,
+		Pia,
+		Aci,
+		Cffa1,
+		Acia
+	};
+
+	struct Slot
+	{
+		Target nTarget = Target::Open;
+		uint8_t nRom = 0;			// index into roms
+		uint16_t nAddr = 0x0000;	// address seen by the memory or device, after mirroring
+	};
+
+	struct Page
+	{
+		const uint8_t* pRead = nullptr;		// nullptr = through vSlots
+		uint8_t* pWrite = nullptr;
+	};
+
+	std::vector<Slot> vSlots;
+	std::array<Page, 256> vPages;
+	uint8_t nOpenBus;
+	bool bOpenBusHigh;
+
+	void BuildMap(const Apple1Config& config);
+	void BuildPage(uint8_t nPage);
+	uint8_t SlotRead(uint16_t addr, bool bReadOnly);
+	void SlotWrite(uint16_t addr, uint8_t data);
+
+	// refresh = exact: stretched ticks counted per cycle at the end of each scan line,
+	// refresh = batch derives them from nSystemClockCounter when asked
+	Apple1Config::Refresh nRefresh;
+	uint64_t nNextRefresh;
+	uint64_t nRefreshTicks = 0;
 
 public: // System Interface
 	// Resets the system
 	void reset();
 	// Clocks the system - a single whole systme tick
 	void clock();
+	// clock() for refresh = exact, which also counts the stretched ticks of each scan line;
+	// the caller picks one once, so the other modes carry no per-cycle refresh check
+	void clockExact();
+	bool IsRefreshExact();
 
 };
 
@@ -0,0 +1,805 @@
+#include "IntegerBasic.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+/*
+Recursive descent over one line (after the line number), following BASIC's own
+syntax check closely enough to pick the same token in every context. Spaces are
+ignored outside of strings and REM, just like BASIC does.
+*/
+
+class IntegerBasic::LineParser
+{
+public:
+	LineParser(const std::string& sLine) :
+		s{ sLine }, i{ 0 }
+	{
+	}
+
+	bool Parse(std::vector<uint8_t>& vTokens)
+	{
+		v.clear();
+
+		while (true)
+		{
+			if (!Statement())
+				return false;
+
+			if (Accept(":"))
+				Emit(0x03);
+			else if (Peek() == 0)
+				break;
+			else
+				return false;
+		}
+
+		Emit(0x01);
+		vTokens = v;
+		return true;
+	}
+
+private:
+	const std::string& s;
+	size_t i;
+	std::vector<uint8_t> v;
+
+	void Emit(uint8_t nToken)
+	{
+		v.push_back(nToken);
+	}
+
+	char Peek()
+	{
+		while (i < s.size() && s[i] == ' ')
+			i++;
+		return i < s.size() ? s[i] : 0;
+	}
+
+	bool Accept(const char* sWord)
+	{
+		Peek();
+		size_t n = 0;
+		while (sWord[n] != 0)
+		{
+			if (i + n >= s.size() || s[i + n] != sWord[n])
+				return false;
+			n++;
+		}
+		i += n;
+		return true;
+	}
+
+	bool Expect(char c, uint8_t nToken)
+	{
+		if (Peek() != c)
+			return false;
+		i++;
+		Emit(nToken);
+		return true;
+	}
+
+	bool AtEnd()
+	{
+		char c = Peek();
+		return c == 0 || c == ':';
+	}
+
+	// a PRINT item follows (not a separator, not the end of the statement)
+	bool ItemNext()
+	{
+		char c = Peek();
+		return !AtEnd() && c != ';' && c != ',';
+	}
+
+	// a name ends in front of the words that may follow a variable, e.g. FOR I=1TON
+	size_t NameEnd(size_t j)
+	{
+		static const char* sStop[] = { "AND", "OR", "MOD", "THEN", "TO", "STEP", "AT" };
+
+		j++;
+		while (j < s.size() && isalnum((unsigned char)s[j]))
+		{
+			for (auto w : sStop)
+				if (s.compare(j, strlen(w), w) == 0)
+					return j;
+			j++;
+		}
+		return j;
+	}
+
+	// a string constant or string variable follows
+	bool StringNext()
+	{
+		char c = Peek();
+		if (c == '"')
+			return true;
+		if (!isalpha((unsigned char)c))
+			return false;
+
+		size_t j = NameEnd(i);
+		while (j < s.size() && s[j] == ' ')
+			j++;
+		return j < s.size() && s[j] == '$';
+	}
+
+	bool Name()
+	{
+		if (!isalpha((unsigned char)Peek()))
+			return false;
+
+		size_t nEnd = NameEnd(i);
+		while (i < nEnd)
+			Emit(s[i++] | 0x80);
+		return true;
+	}
+
+	bool Number()
+	{
+		if (!isdigit((unsigned char)Peek()))
+			return false;
+
+		Emit(s[i] | 0x80);
+
+		uint32_t nValue = 0;
+		while (i < s.size() && isdigit((unsigned char)s[i]))
+		{
+			nValue = nValue * 10 + (s[i++] - '0');
+			if (nValue > 32767)
+				return false;
+		}
+
+		Emit(nValue & 0xFF);
+		Emit(nValue >> 8);
+		return true;
+	}
+
+	bool StringConstant()
+	{
+		if (!Expect('"', 0x28))
+			return false;
+
+		while (i < s.size() && s[i] != '"')
+			Emit(s[i++] | 0x80);
+
+		if (i == s.size())
+			return false;
+
+		i++;
+		Emit(0x29);
+		return true;
+	}
+
+	// string variable, nOpen is the token of '(' - $42 as assignment target, $2A in an expression
+	bool StringVariable(uint8_t nOpen)
+	{
+		if (!Name() || !Expect('$', 0x40))
+			return false;
+
+		if (Peek() != '(')
+			return true;
+
+		if (!Expect('(', nOpen) || !Expression())
+			return false;
+
+		if (nOpen == 0x2A && Expect(',', 0x23) && !Expression())
+			return false;
+
+		return Expect(')', 0x72);
+	}
+
+	bool StringExpression()
+	{
+		return Peek() == '"' ? StringConstant() : StringVariable(0x2A);
+	}
+
+	bool NumericVariable()
+	{
+		if (!Name())
+			return false;
+
+		if (Peek() != '(')
+			return true;
+
+		return Expect('(', 0x2D) && Expression() && Expect(')', 0x72);
+	}
+
+	bool Expression()
+	{
+		static const std::pair<const char*, uint8_t> vOperators[] =
+		{
+			{ ">=", 0x18 }, { "<=", 0x1A }, { "<>", 0x1B },
+			{ "+", 0x12 }, { "-", 0x13 }, { "*", 0x14 }, { "/", 0x15 },
+			{ "=", 0x16 }, { "#", 0x17 }, { ">", 0x19 }, { "<", 0x1C },
+			{ "AND", 0x1D }, { "OR", 0x1E }, { "MOD", 0x1F }, { "^", 0x20 }
+		};
+
+		if (!Operand())
+			return false;
+
+		while (true)
+		{
+			bool bOperator = false;
+			for (auto& op : vOperators)
+			{
+				if (Accept(op.first))
+				{
+					Emit(op.second);
+					bOperator = true;
+					break;
+				}
+			}
+
+			if (!bOperator)
+				return true;
+
+			if (!Operand())
+				return false;
+		}
+	}
+
+	bool Operand()
+	{
+		static const std::pair<const char*, uint8_t> vFunctions[] =
+		{
+			{ "PEEK", 0x2E }, { "RND", 0x2F }, { "SGN", 0x30 }, { "ABS", 0x31 }, { "USR", 0x32 }
+		};
+
+		while (true)
+		{
+			if (Accept("-"))
+				Emit(0x36);
+			else if (Accept("+"))
+				Emit(0x35);
+			else if (Accept("NOT"))
+				Emit(0x37);
+			else
+				break;
+		}
+
+		char c = Peek();
+
+		if (isdigit((unsigned char)c))
+			return Number();
+
+		if (c == '(')
+			return Expect('(', 0x38) && Expression() && Expect(')', 0x72);
+
+		for (auto& fn : vFunctions)
+		{
+			if (Accept(fn.first))
+			{
+				Emit(fn.second);
+				return Expect('(', 0x3F) && Expression() && Expect(')', 0x72);
+			}
+		}
+
+		if (Accept("LEN"))
+		{
+			if (Peek() != '(')
+				return false;
+			i++;
+			Emit(0x3B);
+			return StringExpression() && Expect(')', 0x72);
+		}
+
+		if (Accept("HIMEM"))
+		{
+			Emit(0x3D);
+			return true;
+		}
+
+		if (Accept("LOMEM"))
+		{
+			Emit(0x3E);
+			return true;
+		}
+
+		// string comparison yields a number
+		if (StringNext())
+		{
+			if (!StringExpression())
+				return false;
+			if (!Expect('=', 0x39) && !Expect('#', 0x3A))
+				return false;
+			return StringExpression();
+		}
+
+		return NumericVariable();
+	}
+
+	bool Statement()
+	{
+		if (Accept("REM"))
+		{
+			Emit(0x5D);
+			while (i < s.size())
+				Emit(s[i++] | 0x80);
+			return true;
+		}
+
+		if (Accept("LET"))
+		{
+			Emit(0x5E);
+			return Assignment();
+		}
+
+		if (Accept("DIM"))
+			return Dim();
+
+		if (Accept("PRINT"))
+			return Print();
+
+		if (Accept("INPUT"))
+			return Input();
+
+		if (Accept("IF"))
+		{
+			Emit(0x60);
+			if (!Expression() || !Accept("THEN"))
+				return false;
+
+			// THEN line number or THEN statement
+			if (isdigit((unsigned char)Peek()))
+			{
+				Emit(0x24);
+				return Expression();
+			}
+
+			Emit(0x25);
+			return Statement();
+		}
+
+		if (Accept("FOR"))
+		{
+			Emit(0x55);
+			if (!Name() || !Expect('=', 0x56) || !Expression() || !Accept("TO"))
+				return false;
+			Emit(0x57);
+			if (!Expression())
+				return false;
+			if (Accept("STEP"))
+			{
+				Emit(0x58);
+				return Expression();
+			}
+			return true;
+		}
+
+		if (Accept("NEXT"))
+		{
+			Emit(0x59);
+			if (!Name())
+				return false;
+			while (Expect(',', 0x5A))
+			{
+				if (!Name())
+					return false;
+			}
+			return true;
+		}
+
+		if (Accept("GOTO"))
+		{
+			Emit(0x5F);
+			return Expression();
+		}
+
+		if (Accept("GOSUB"))
+		{
+			Emit(0x5C);
+			return Expression();
+		}
+
+		if (Accept("RETURN"))
+		{
+			Emit(0x5B);
+			return true;
+		}
+
+		if (Accept("END"))
+		{
+			Emit(0x51);
+			return true;
+		}
+
+		if (Accept("CALL"))
+		{
+			Emit(0x4D);
+			return Expression();
+		}
+
+		if (Accept("POKE"))
+		{
+			Emit(0x64);
+			return Expression() && Expect(',', 0x65) && Expression();
+		}
+
+		if (Accept("TAB"))
+		{
+			Emit(0x50);
+			return Expression();
+		}
+
+		if (Accept("COLOR"))
+		{
+			if (Peek() != '=')
+				return false;
+			i++;
+			Emit(0x66);
+			return Expression();
+		}
+
+		if (Accept("PLOT"))
+		{
+			Emit(0x67);
+			return Expression() && Expect(',', 0x68) && Expression();
+		}
+
+		if (Accept("HLIN"))
+		{
+			Emit(0x69);
+			if (!Expression() || !Expect(',', 0x6A) || !Expression() || !Accept("AT"))
+				return false;
+			Emit(0x6B);
+			return Expression();
+		}
+
+		// commands only, BASIC does not store them
+		if (Accept("HIMEM") || Accept("LOMEM"))
+			return false;
+
+		return Assignment();
+	}
+
+	bool Assignment()
+	{
+		if (StringNext())
+			return StringVariable(0x42) && Expect('=', 0x70) && StringExpression();
+
+		return NumericVariable() && Expect('=', 0x71) && Expression();
+	}
+
+	// DIM and its separators are chosen by the type of the following array
+	bool Dim()
+	{
+		bool bFirst = true;
+
+		do
+		{
+			bool bString = StringNext();
+			if (bFirst)
+				Emit(bString ? 0x4E : 0x4F);
+			else
+				Emit(bString ? 0x43 : 0x44);
+			bFirst = false;
+
+			if (!Name())
+				return false;
+			if (bString && !Expect('$', 0x40))
+				return false;
+			if (!Expect('(', bString ? 0x22 : 0x34) || !Expression() || !Expect(')', 0x72))
+				return false;
+
+		} while (Accept(","));
+
+		return true;
+	}
+
+	// PRINT and its separators are chosen by the type of the following item
+	bool Print()
+	{
+		if (AtEnd())
+		{
+			Emit(0x63);
+			return true;
+		}
+
+		if (!ItemNext())
+			return false;
+
+		Emit(StringNext() ? 0x61 : 0x62);
+
+		while (true)
+		{
+			if (ItemNext())
+			{
+				if (StringNext() ? !StringExpression() : !Expression())
+					return false;
+			}
+
+			if (AtEnd())
+				return true;
+
+			if (Accept(";"))
+				Emit(!ItemNext() ? 0x47 : StringNext() ? 0x45 : 0x46);
+			else if (Accept(","))
+			{
+				if (!ItemNext())
+					return false;
+				Emit(StringNext() ? 0x48 : 0x49);
+			}
+			else
+				return false;
+		}
+	}
+
+	// INPUT and its separators are chosen by the type of the following variable
+	bool Input()
+	{
+		bool bFirst = true;
+
+		if (Peek() == '"')
+		{
+			Emit(0x53);
+			if (!StringConstant() || !Accept(","))
+				return false;
+			bFirst = false;
+		}
+
+		do
+		{
+			bool bString = StringNext();
+			if (bFirst)
+				Emit(bString ? 0x52 : 0x54);
+			else
+				Emit(bString ? 0x26 : 0x27);
+			bFirst = false;
+
+			if (bString ? !StringVariable(0x42) : !NumericVariable())
+				return false;
+
+		} while (Accept(","));
+
+		return true;
+	}
+};
+
+bool IntegerBasic::Tokenize(const std::string& sText, std::vector<uint8_t>& vProgram, std::string& sError)
+{
+	std::map<uint16_t, std::vector<uint8_t>> mapLines;
+
+	std::istringstream iss(sText);
+	std::string sLine;
+	size_t nLineCount = 0;
+
+	while (std::getline(iss, sLine))
+	{
+		nLineCount++;
+
+		// the Apple 1 keyboard only sends upper case
+		std::string sUpper;
+		for (char c : sLine)
+		{
+			if (c != '\r')
+				sUpper += (char)toupper((unsigned char)c);
+		}
+
+		size_t p = sUpper.find_first_not_of(' ');
+		if (p == std::string::npos)
+			continue;
+
+		if (!isdigit((unsigned char)sUpper[p]))
+		{
+			sError = "line " + std::to_string(nLineCount) + ": missing line number";
+			return false;
+		}
+
+		uint32_t nNumber = 0;
+		while (p < sUpper.size() && isdigit((unsigned char)sUpper[p]))
+		{
+			nNumber = nNumber * 10 + (sUpper[p++] - '0');
+			if (nNumber > 32767)
+			{
+				sError = "line " + std::to_string(nLineCount) + ": line number out of range";
+				return false;
+			}
+		}
+
+		std::string sStatements = sUpper.substr(p);
+
+		// a line number alone deletes the line
+		if (sStatements.find_first_not_of(' ') == std::string::npos)
+		{
+			mapLines.erase((uint16_t)nNumber);
+			continue;
+		}
+
+		std::vector<uint8_t> vTokens;
+		LineParser parser(sStatements);
+		if (!parser.Parse(vTokens))
+		{
+			sError = "line " + std::to_string(nLineCount) + ": syntax error";
+			return false;
+		}
+
+		if (vTokens.size() + 3 > 0xFF)
+		{
+			sError = "line " + std::to_string(nLineCount) + ": line too long";
+			return false;
+		}
+
+		std::vector<uint8_t>& vLine = mapLines[(uint16_t)nNumber];
+		vLine.clear();
+		vLine.push_back((uint8_t)(vTokens.size() + 3));
+		vLine.push_back(nNumber & 0xFF);
+		vLine.push_back(nNumber >> 8);
+		vLine.insert(vLine.end(), vTokens.begin(), vTokens.end());
+	}
+
+	vProgram.clear();
+	for (auto& line : mapLines)
+		vProgram.insert(vProgram.end(), line.second.begin(), line.second.end());
+
+	return true;
+}
+
+std::string IntegerBasic::Detokenize(const std::vector<uint8_t>& vProgram)
+{
+	// token texts as printed by LIST, nullptr = never stored by BASIC
+	static const char* sTokenText[0x80] =
+	{
+		",", nullptr, nullptr, ":", " LIST ", nullptr, " LIST ", " RUN ",
+		" RUN ", " DEL ", ",", " SCR ", " CLR ", " AUTO ", ",", " OFF ",
+		" HIMEM=", " LOMEM=", "+", "-", "*", "/", "=", "#",
+		">=", ">", "<=", "<>", "<", " AND ", " OR ", " MOD ",
+		" ^ ", "+", "(", ",", " THEN ", " THEN ", ",", ",",
+		"\"", "\"", "(", "!", "!", "(", " PEEK ", " RND ",
+		" SGN ", " ABS ", " USR ", " RNDX ", "(", "+", "-", " NOT ",
+		"(", "=", "#", " LEN(", " COLOR ", " HIMEM ", " LOMEM ", "(",
+		"$", "$", "(", ",", ",", ";", ";", ";",
+		",", ",", "!", nullptr, nullptr, " CALL ", " DIM ", " DIM ",
+		" TAB ", " END ", " INPUT ", " INPUT ", " INPUT ", " FOR ", "=", " TO ",
+		" STEP ", " NEXT ", ",", " RETURN ", " GOSUB ", " REM ", " LET ", " GOTO ",
+		" IF ", " PRINT ", " PRINT ", " PRINT ", " POKE ", ",", " COLOR=", " PLOT ",
+		",", " HLIN ", ",", " AT ", nullptr, ",", "+", "-",
+		"=", "=", ")", ")", nullptr, ",", "+", "-",
+		nullptr, ")", "+", nullptr, nullptr, ")", nullptr, ")"
+	};
+
+	std::string sOut;
+
+	auto Append = [&sOut](const char* sText)
+	{
+		if (sText[0] == ' ' && !sOut.empty() && sOut.back() == ' ')
+			sText++;
+		sOut += sText;
+	};
+
+	size_t nLine = 0;
+	while (nLine + 4 <= vProgram.size())
+	{
+		size_t nLen = vProgram[nLine];
+		if (nLen < 4 || nLine + nLen > vProgram.size())
+			break;
+
+		size_t nEnd = nLine + nLen - 1;	// end of line token
+		sOut += std::to_string(vProgram[nLine + 1] | (vProgram[nLine + 2] << 8)) + " ";
+
+		size_t j = nLine + 3;
+		bool bName = false;
+		while (j < nEnd)
+		{
+			uint8_t b = vProgram[j++];
+
+			if (b >= 0x80)
+			{
+				// a digit after a token starts a number constant, after a letter it is part of a name
+				if (!bName && b >= 0xB0 && b <= 0xB9 && j + 2 <= nEnd)
+				{
+					sOut += std::to_string(vProgram[j] | (vProgram[j + 1] << 8));
+					j += 2;
+				}
+				else
+				{
+					sOut += (char)(b & 0x7F);
+					bName = true;
+					continue;
+				}
+			}
+			else if (b == 0x28)
+			{
+				sOut += '"';
+				while (j < nEnd && vProgram[j] != 0x29)
+					sOut += (char)(vProgram[j++] & 0x7F);
+				if (j < nEnd)
+					j++;
+				sOut += '"';
+			}
+			else if (b == 0x5D)
+			{
+				// REM keeps its text as typed
+				Append(" REM");
+				while (j < nEnd)
+					sOut += (char)(vProgram[j++] & 0x7F);
+			}
+			else
+				Append(sTokenText[b] ? sTokenText[b] : "?");
+
+			bName = false;
+		}
+
+		sOut += "\n";
+		nLine += nLen;
+	}
+
+	return sOut;
+}
+
+LoadResult IntegerBasic::Load(Bus& bus, const std::string& sText)
+{
+	LoadResult result;
+
+	std::vector<uint8_t> vProgram;
+	if (!Tokenize(sText, vProgram, result.sError))
+		return result;
+
+	uint16_t nLomem = ReadPtr(bus, nLomemPtr);
+	uint16_t nHimem = ReadPtr(bus, nHimemPtr);
+
+	// BASIC not started yet - set up what its cold start would
+	if (nHimem == 0x0000 || nLomem >= nHimem)
+	{
+		nLomem = nDefaultLomem;
+		nHimem = nDefaultHimem;
+		WritePtr(bus, nLomemPtr, nLomem);
+		WritePtr(bus, nHimemPtr, nHimem);
+	}
+
+	if (vProgram.size() > (size_t)(nHimem - nLomem))
+	{
+		result.sError = "program does not fit between LOMEM and HIMEM";
+		return result;
+	}
+
+	uint16_t nStart = nHimem - (uint16_t)vProgram.size();
+	std::copy(vProgram.begin(), vProgram.end(), bus.ram.begin() + nStart);
+
+	// program replaced - variables are gone
+	WritePtr(bus, nProgramPtr, nStart);
+	WritePtr(bus, nVariablePtr, nLomem);
+
+	result.bValid = true;
+	result.nBytes = vProgram.size();
+	result.nLow = nStart;
+	result.nHigh = nHimem - 1;
+	result.bRun = true;
+	result.nRunAddress = nWarmStart;
+	return result;
+}
+
+std::string IntegerBasic::Export(Bus& bus)
+{
+	uint16_t nStart = ReadPtr(bus, nProgramPtr);
+	uint16_t nHimem = ReadPtr(bus, nHimemPtr);
+
+	if (nStart >= nHimem)
+		return std::string();
+
+	return Detokenize(std::vector<uint8_t>(bus.ram.begin() + nStart, bus.ram.begin() + nHimem));
+}
+
+bool IntegerBasic::SaveFile(Bus& bus, const std::string& sFileName)
+{
+	std::ofstream ofs(sFileName, std::ofstream::binary);
+	if (!ofs.is_open())
+		return false;
+
+	ofs << Export(bus);
+	return ofs.good();
+}
+
+uint16_t IntegerBasic::ReadPtr(Bus& bus, uint16_t nAddr)
+{
+	return bus.ram[nAddr] | (bus.ram[nAddr + 1] << 8);
+}
+
+void IntegerBasic::WritePtr(Bus& bus, uint16_t nAddr, uint16_t nValue)
+{
+	bus.ram[nAddr] = nValue & 0xFF;
+	bus.ram[nAddr + 1] = nValue >> 8;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Bus.h"
+#include "ProgramLoader.h"
+
+/*
+Apple 1 Integer BASIC programs as text listings.
+
+BASIC keeps its program tokenized at the top of its memory: the lines are stored
+in ascending order from PP up to HIMEM, each as
+	[length incl. header and end][line number lo][line number hi] tokens... [01]
+Keywords, operators and separators are one byte tokens below $80 - the same
+character may have several tokens depending on the syntax context, e.g. the ';'
+of PRINT is $45 before a string, $46 before a number and $47 at the end.
+Variable names and string characters are stored as ASCII with bit 7 set,
+number constants as the first digit (bit 7 set) followed by the 16 bit value.
+
+Tokenize() produces exactly what BASIC stores when the lines are typed in, so a
+listing goes into RAM in one go instead of being typed key by key.
+*/
+
+class IntegerBasic
+{
+public:
+	// tokenize a listing ("10 PRINT A" per line), sError names the first line BASIC would reject
+	static bool Tokenize(const std::string& sText, std::vector<uint8_t>& vProgram, std::string& sError);
+
+	// listing of a tokenized program, formatted like LIST
+	static std::string Detokenize(const std::vector<uint8_t>& vProgram);
+
+	// tokenize sText into Bus::ram below HIMEM and set the program pointer, the
+	// result asks to run BASIC's warm start which keeps the program
+	static LoadResult Load(Bus& bus, const std::string& sText);
+
+	// listing of the program currently in Bus::ram
+	static std::string Export(Bus& bus);
+	static bool SaveFile(Bus& bus, const std::string& sFileName);
+
+	const static uint16_t nWarmStart = 0xE2B3;
+
+private:
+	class LineParser;
+
+	// zero page pointers
+	const static uint16_t nLomemPtr = 0x004A;
+	const static uint16_t nHimemPtr = 0x004C;
+	const static uint16_t nProgramPtr = 0x00CA;	// PP - start of program
+	const static uint16_t nVariablePtr = 0x00CC;	// PV - end of variables
+
+	// defaults of BASIC's cold start
+	const static uint16_t nDefaultLomem = 0x0800;
+	const static uint16_t nDefaultHimem = 0x1000;
+
+	static uint16_t ReadPtr(Bus& bus, uint16_t nAddr);
+	static void WritePtr(Bus& bus, uint16_t nAddr, uint16_t nValue);
+};
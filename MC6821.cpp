@@ -19,8 +19,11 @@ MC6821::MC6821()
 	nDDRA = nDDRB = 0;
 	nDDRA_neg = nDDRB_neg = 0xFF;
 
+	nCRAReadCount = 0;
+
 	fSendInterrupt = NULL;
 	fSendOutputA = fSendOutputB = NULL;
+	fReceiveInputA = fReceiveInputB = NULL;
 
 	updateControlRegisters();
 }
@@ -114,7 +117,10 @@ uint8_t MC6821::cpuRead(uint16_t addr, bool rdonly)
 	{
 	case 0: // PA
 
-		nCRA &= 0x3F;  // IRQ flags implicitly cleared by a read
+		if (!rdonly) nCRA &= 0x3F;  // IRQ flags implicitly cleared by a read, not by the debugger's
+
+		if (fReceiveInputA)
+			nIRA = fReceiveInputA();
 
 		// mix input and output
 		data |= nORA & nDDRA;
@@ -124,11 +130,15 @@ uint8_t MC6821::cpuRead(uint16_t addr, bool rdonly)
 
 	case 1: // CRA
 		data = nCRA;
+		if (!rdonly) nCRAReadCount++;
 		break;
 
 	case 2: // PB
 
-		nCRB &= 0x3F; // IRQ flags implicitly cleared by a read
+		if (!rdonly) nCRB &= 0x3F;  // IRQ flags implicitly cleared by a read, not by the debugger's
+
+		if (fReceiveInputB)
+			nIRB = fReceiveInputB();
 
 		// mix input and output
 		data |= nORB & nDDRB;
@@ -231,6 +241,16 @@ void MC6821::setOutputBHandler(std::function<void(uint8_t)> h)
 	fSendOutputB = h;
 }
 
+void MC6821::setInputAHandler(std::function<uint8_t()> h)
+{
+	fReceiveInputA = h;
+}
+
+void MC6821::setInputBHandler(std::function<uint8_t()> h)
+{
+	fReceiveInputB = h;
+}
+
 void MC6821::setInterruptHandler(std::function<void(SignalProcessing::InterruptSignal)> h)
 {
 	fSendInterrupt = h;
@@ -300,3 +320,9 @@ Signal MC6821::getCB2()
 {
 	return nCB2;
 }
+
+
+uint32_t MC6821::getCRAReadCount()
+{
+	return nCRAReadCount;
+}
\ No newline at end of file
@@ -1,9 +1,8 @@
 #pragma once
 #include <cstdint>
+#include <functional>
 #include <memory>
 
-#include "olcPixelGameEngine.h"
-
 
 namespace SignalProcessing
 {
@@ -67,8 +66,12 @@ protected:
 	bool bCRB_Bit4_ManualOutput;
 	bool bCRB_Bit5_OutputMode;
 
+	uint32_t nCRAReadCount; // number of CRA reads, used to detect keyboard polling
+
 	std::function<void(uint8_t)> fSendOutputA;
 	std::function<void(uint8_t)> fSendOutputB;
+	std::function<uint8_t()> fReceiveInputA;
+	std::function<uint8_t()> fReceiveInputB;
 	std::function<void(SignalProcessing::InterruptSignal)> fSendInterrupt;
 
 public:
@@ -81,6 +84,9 @@ public:
 
 	void setOutputAHandler(std::function<void(uint8_t)> h);
 	void setOutputBHandler(std::function<void(uint8_t)> h);
+	// input lines sampled when the CPU reads the port, instead of the last setInput value
+	void setInputAHandler(std::function<uint8_t()> h);
+	void setInputBHandler(std::function<uint8_t()> h);
 	void setInterruptHandler(std::function<void(SignalProcessing::InterruptSignal)> h);
 
 	void setCA1(Signal b);
@@ -93,6 +99,8 @@ public:
 	void setCB2(Signal b);
 	Signal getCB2();
 
+	uint32_t getCRAReadCount();
+
 private:
 	void updateControlRegisters();
 	void updateIRQ();
@@ -0,0 +1,169 @@
+#include "MOS6551.h"
+
+MOS6551::MOS6551()
+{
+	nDroppedBytes = 0;
+	reset();
+}
+
+MOS6551::~MOS6551()
+{
+}
+
+void MOS6551::reset()
+{
+	// hardware reset: receiver IRQ disabled, transmitter empty
+	nData = 0x00;
+	nCommand = 0x02;
+	nControl = 0x00;
+	bRdrf = false;
+	bIrq = false;
+}
+
+uint8_t MOS6551::cpuRead(uint16_t addr, bool bReadOnly)
+{
+	uint8_t data = 0x00;
+
+	switch (addr & 0x03)
+	{
+	case 0x00:
+		if (!bReadOnly)
+			Update();
+		data = nData;
+		if (!bReadOnly)
+		{
+			bRdrf = false;
+			bIrq = false;
+		}
+		break;
+
+	case 0x01:
+		// DCD and DSR (bits 5, 6) low = carrier, TDRE always set
+		if (!bReadOnly)
+			Update();
+		data = (bIrq ? 0x80 : 0x00) | 0x10 | (bRdrf ? 0x08 : 0x00);
+		if (!bReadOnly)
+			bIrq = false;
+		break;
+
+	case 0x02:
+		data = nCommand;
+		break;
+
+	case 0x03:
+		data = nControl;
+		break;
+	}
+
+	return data;
+}
+
+void MOS6551::cpuWrite(uint16_t addr, uint8_t data)
+{
+	switch (addr & 0x03)
+	{
+	case 0x00:
+		if (!txRing.Push(data))
+			nDroppedBytes++;
+		else if (fTransmitted)
+			fTransmitted();
+		// the transmit register is empty again right away
+		if (TransmitIrqEnabled())
+			bIrq = true;
+		break;
+
+	case 0x01:
+		// programmed reset keeps the parity mode and the control register
+		nCommand &= 0xE0;
+		bIrq = false;
+		break;
+
+	case 0x02:
+		nCommand = data;
+		if (TransmitIrqEnabled())
+			bIrq = true;
+		break;
+
+	case 0x03:
+		nControl = data;
+		break;
+	}
+}
+
+bool MOS6551::Update()
+{
+	// the receiver is off while DTR is not set
+	if (!bRdrf && (nCommand & 0x01) && rxRing.Pop(nData))
+	{
+		bRdrf = true;
+		if (ReceiveIrqEnabled())
+			bIrq = true;
+	}
+
+	return bIrq;
+}
+
+bool MOS6551::IrqAsserted()
+{
+	return bIrq;
+}
+
+uint32_t MOS6551::getCharacterCycles()
+{
+	// 0 = the external 16x clock, 1.8432 MHz on most cards
+	static const uint32_t vBaud[16] = { 115200, 50, 75, 110, 135, 150, 300, 600, 1200, 1800, 2400, 3600, 4800, 7200, 9600, 19200 };
+	return 1022727 * 10 / vBaud[nControl & 0x0F];
+}
+
+bool MOS6551::ReceivePending()
+{
+	return !bRdrf && (nCommand & 0x01) && !rxRing.Empty();
+}
+
+uint32_t MOS6551::getDroppedBytes()
+{
+	return nDroppedBytes;
+}
+
+bool MOS6551::PushReceived(uint8_t data)
+{
+	return rxRing.Push(data);
+}
+
+bool MOS6551::PopTransmitted(uint8_t& data)
+{
+	return txRing.Pop(data);
+}
+
+size_t MOS6551::ReceiveSpace()
+{
+	return rxRing.Capacity() - rxRing.Size();
+}
+
+void MOS6551::setReceiveHandler(std::function<void()> h)
+{
+	std::lock_guard<std::mutex> lock(mtxReceived);
+	fReceived = h;
+}
+
+void MOS6551::Received()
+{
+	std::lock_guard<std::mutex> lock(mtxReceived);
+	if (fReceived)
+		fReceived();
+}
+
+void MOS6551::setTransmitHandler(std::function<void()> h)
+{
+	fTransmitted = h;
+}
+
+bool MOS6551::ReceiveIrqEnabled()
+{
+	return (nCommand & 0x03) == 0x01;
+}
+
+bool MOS6551::TransmitIrqEnabled()
+{
+	return (nCommand & 0x0D) == 0x05;
+}
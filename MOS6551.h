@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+#include "SpscRing.h"
+
+/*
+6551 ACIA as found on serial cards: four registers, repeated through the card's
+16 bytes.
+
+	+0 data				read: received byte, clears RDRF; write: transmit
+	+1 status			read: bit 7 IRQ, 4 TDRE, 3 RDRF; write: programmed reset
+	+2 command			bit 0 DTR (receiver on), bit 1 receive IRQ disabled,
+						bits 2-3 = 01 transmit IRQ enabled
+	+3 control			bits 0-3 baud rate
+
+The serial line is a pair of rings to the host side (see PtyBridge), which runs
+on its own thread. Bytes are transmitted at once, TDRE is always set again when
+the CPU looks; a byte that finds the transmit ring full is dropped and counted,
+like a line without a listener. A received byte moves from the ring into the receive register when
+the CPU reads the status or data register, and at the character time of the
+programmed baud rate through Update(), which the machine calls as a scheduled
+event rather than every instruction.
+*/
+
+class MOS6551
+{
+public:
+	MOS6551();
+	~MOS6551();
+
+public:
+	// Communications with Main Bus, the register is selected by address bits 0-1
+	uint8_t cpuRead(uint16_t addr, bool bReadOnly = false);
+	void    cpuWrite(uint16_t addr, uint8_t data);
+
+	void reset();
+
+	// takes the next received byte if the receive register is free,
+	// true while the IRQ line is held
+	bool Update();
+	bool IrqAsserted();
+
+	// CPU cycles of one character (start, 8 data, stop bit) at the programmed baud rate
+	uint32_t getCharacterCycles();
+
+	// a received byte waits for the free receive register, Update() would take it
+	bool ReceivePending();
+
+	// transmitted bytes lost because the host side did not take them
+	uint32_t getDroppedBytes();
+
+public: // host side
+	bool PushReceived(uint8_t data);
+	bool PopTransmitted(uint8_t& data);
+	size_t ReceiveSpace();
+
+	// called on the host thread after bytes were received, e.g. to wake the emulation
+	void setReceiveHandler(std::function<void()> h);
+	void Received();
+	// called on the emulation thread after a byte was transmitted
+	void setTransmitHandler(std::function<void()> h);
+
+private:
+	uint8_t nData;
+	uint8_t nCommand;
+	uint8_t nControl;
+	bool bRdrf;
+	bool bIrq;
+	uint32_t nDroppedBytes;
+
+	SpscRing<uint8_t, 4096> rxRing;
+	SpscRing<uint8_t, 4096> txRing;
+
+	std::mutex mtxReceived;		// the handler is set while the host thread may call it
+	std::function<void()> fReceived;
+	std::function<void()> fTransmitted;
+
+	bool ReceiveIrqEnabled();
+	bool TransmitIrqEnabled();
+};
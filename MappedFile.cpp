@@ -0,0 +1,130 @@
+#include "MappedFile.h"
+
+#include <filesystem>
+#include <map>
+#include <mutex>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+{
+	pData = nullptr;
+	nSize = 0;
+#ifdef _WIN32
+	hFile = INVALID_HANDLE_VALUE;
+	hMapping = nullptr;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+	if (pData)
+		UnmapViewOfFile(pData);
+	if (hMapping)
+		CloseHandle(hMapping);
+	if (hFile != INVALID_HANDLE_VALUE)
+		CloseHandle(hFile);
+#else
+	if (pData)
+		munmap((void*)pData, nSize);
+#endif
+}
+
+std::shared_ptr<const MappedFile> MappedFile::Open(const std::string& sFileName)
+{
+	static std::mutex mtx;
+	static std::map<std::string, std::weak_ptr<const MappedFile>> mapOpen;
+
+	std::error_code ec;
+	std::string sKey = std::filesystem::absolute(sFileName, ec).lexically_normal().string();
+	if (ec)
+		sKey = sFileName;
+
+	std::lock_guard<std::mutex> lock(mtx);
+
+	auto it = mapOpen.find(sKey);
+	if (it != mapOpen.end())
+	{
+		if (auto file = it->second.lock())
+			return file;
+	}
+
+	std::shared_ptr<MappedFile> file(new MappedFile());
+	if (!file->Map(sFileName))
+		return nullptr;
+
+	mapOpen[sKey] = file;
+	return file;
+}
+
+const uint8_t* MappedFile::Data() const
+{
+	return pData;
+}
+
+size_t MappedFile::Size() const
+{
+	return nSize;
+}
+
+bool MappedFile::Map(const std::string& sFileName)
+{
+#ifdef _WIN32
+	hFile = CreateFileA(sFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(hFile, &size))
+		return false;
+
+	nSize = (size_t)size.QuadPart;
+	if (nSize == 0)
+		return true;
+
+	hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!hMapping)
+		return false;
+
+	pData = (const uint8_t*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+	return pData != nullptr;
+#else
+	int fd = open(sFileName.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+	{
+		close(fd);
+		return false;
+	}
+
+	nSize = (size_t)st.st_size;
+	if (nSize == 0)
+	{
+		close(fd);
+		return true;
+	}
+
+	// the mapping stays valid after closing the descriptor
+	void* p = mmap(nullptr, nSize, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (p == MAP_FAILED)
+		return false;
+
+	pData = (const uint8_t*)p;
+	return true;
+#endif
+}
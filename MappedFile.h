@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/*
+Read only memory mapping of a file (mmap, MapViewOfFile on Windows). Open()
+hands out one shared mapping per file, so all machines of a process read the
+same pages, and other processes mapping the file share them via the page cache.
+*/
+
+class MappedFile
+{
+public:
+	~MappedFile();
+
+	// nullptr if the file cannot be opened or mapped
+	static std::shared_ptr<const MappedFile> Open(const std::string& sFileName);
+
+	const uint8_t* Data() const;
+	size_t Size() const;
+
+private:
+	MappedFile();
+
+	const uint8_t* pData;
+	size_t nSize;
+
+#ifdef _WIN32
+	void* hFile;
+	void* hMapping;
+#endif
+
+	bool Map(const std::string& sFileName);
+};
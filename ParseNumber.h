@@ -0,0 +1,43 @@
+#pragma once
+#include <cctype>
+#include <cstdint>
+#include <string>
+
+/*
+Checked parsing of numbers from the command line and config files: the whole
+string has to be the number, without sign, blanks or trailing characters, and
+within range. The std::sto* functions throw on garbage and silently stop at
+the first character they do not understand.
+*/
+
+inline bool ParseNumber(const std::string& sValue, uint64_t& nValue, int nBase = 10, uint64_t nMax = UINT64_MAX)
+{
+	if (sValue.empty() || !std::isxdigit((unsigned char)sValue[0]))
+		return false;
+
+	try
+	{
+		size_t nEnd = 0;
+		uint64_t n = std::stoull(sValue, &nEnd, nBase);
+		if (nEnd != sValue.size() || n > nMax)
+			return false;
+
+		nValue = n;
+		return true;
+	}
+	catch (...)
+	{
+		return false;
+	}
+}
+
+// 16 bit hex address, 0-FFFF
+inline bool ParseAddress(const std::string& sValue, uint16_t& nAddr)
+{
+	uint64_t n = 0;
+	if (!ParseNumber(sValue, n, 16, 0xFFFF))
+		return false;
+
+	nAddr = (uint16_t)n;
+	return true;
+}
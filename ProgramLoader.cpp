@@ -0,0 +1,131 @@
+#include "ProgramLoader.h"
+#include "IntegerBasic.h"
+#include "MappedFile.h"
+#include "ParseNumber.h"
+
+#include <cctype>
+
+/*
+The Woz Monitor text is parsed the way the monitor itself does it: every line
+starts in examine mode, a hex number sets the examine and store address, ':'
+switches to store mode where each following hex number stores its low byte
+and advances the store address, '.' examines a range (ignored here) and 'R'
+runs from the last examined address.
+*/
+
+LoadResult ProgramLoader::LoadWozHex(Bus& bus, const std::string& sText)
+{
+	enum Mode { Examine, BlockExamine, StoreBytes };
+
+	LoadResult result;
+	uint16_t nStore = 0x0000;
+	uint16_t nExamine = 0x0000;
+	Mode mode = Mode::Examine;
+
+	size_t i = 0;
+	while (i < sText.size())
+	{
+		char c = sText[i];
+
+		if (c == '\n' || c == '\r')
+		{
+			mode = Mode::Examine;
+			i++;
+		}
+		else if (c == ':')
+		{
+			mode = Mode::StoreBytes;
+			i++;
+		}
+		else if (c == '.')
+		{
+			mode = Mode::BlockExamine;
+			i++;
+		}
+		else if (c == 'R' || c == 'r')
+		{
+			result.bRun = true;
+			result.nRunAddress = nExamine;
+			i++;
+		}
+		else if (isxdigit((unsigned char)c))
+		{
+			uint16_t nValue = 0;
+			while (i < sText.size() && isxdigit((unsigned char)sText[i]))
+			{
+				char d = sText[i++];
+				nValue = (nValue << 4) | (uint16_t)(isdigit((unsigned char)d) ? d - '0' : (toupper(d) - 'A' + 10));
+			}
+
+			if (mode == Mode::StoreBytes)
+				Store(bus, result, nStore++, nValue & 0xFF);
+			else if (mode == Mode::Examine)
+				nStore = nExamine = nValue;
+		}
+		else
+			i++;
+	}
+
+	result.bValid = result.nBytes > 0 || result.bRun;
+	return result;
+}
+
+LoadResult ProgramLoader::LoadBinary(Bus& bus, const std::vector<uint8_t>& vData, uint16_t nAddr)
+{
+	return LoadBinary(bus, vData.data(), vData.size(), nAddr);
+}
+
+LoadResult ProgramLoader::LoadBinary(Bus& bus, const uint8_t* pData, size_t nSize, uint16_t nAddr)
+{
+	LoadResult result;
+
+	for (size_t i = 0; i < nSize; i++)
+		Store(bus, result, nAddr++, pData[i]);
+
+	result.bValid = result.nBytes > 0;
+	return result;
+}
+
+LoadResult ProgramLoader::LoadFile(Bus& bus, const std::string& sSpec)
+{
+	std::string sFileName = sSpec;
+	bool bBinary = false;
+	uint16_t nAddr = 0x0000;
+
+	size_t nAt = sSpec.rfind('@');
+	if (nAt != std::string::npos)
+	{
+		sFileName = sSpec.substr(0, nAt);
+		bBinary = true;
+		if (!ParseAddress(sSpec.substr(nAt + 1), nAddr))
+		{
+			LoadResult result;
+			result.sError = "load address expects hex up to FFFF, got " + sSpec.substr(nAt + 1);
+			return result;
+		}
+	}
+
+	// mapped, so a program library shared by many machines is read once
+	auto file = MappedFile::Open(sFileName);
+	if (!file)
+		return LoadResult();
+
+	if (bBinary)
+		return LoadBinary(bus, file->Data(), file->Size(), nAddr);
+
+	std::string sText((const char*)file->Data(), file->Size());
+
+	if (sFileName.size() > 4 && sFileName.compare(sFileName.size() - 4, 4, ".bas") == 0)
+		return IntegerBasic::Load(bus, sText);
+
+	return LoadWozHex(bus, sText);
+}
+
+void ProgramLoader::Store(Bus& bus, LoadResult& result, uint16_t nAddr, uint8_t data)
+{
+	bus.ram[nAddr] = data;
+
+	result.nBytes++;
+	if (nAddr < result.nLow) result.nLow = nAddr;
+	if (nAddr > result.nHigh) result.nHigh = nAddr;
+}
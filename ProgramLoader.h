@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Bus.h"
+
+/*
+Loads programs straight into Bus::ram, bypassing keyboard and monitor:
+- Woz Monitor text as typed into or dumped by the monitor, e.g.
+	0300: A9 00 85 30
+	: 4C 00 03
+	0300R
+- raw binary images at a given load address
+- Integer BASIC listings (*.bas), see IntegerBasic
+*/
+
+struct LoadResult
+{
+	bool bValid = false;
+	size_t nBytes = 0;
+	uint16_t nLow = 0xFFFF;
+	uint16_t nHigh = 0x0000;
+	bool bRun = false;			// Woz text contained an 'R' command
+	uint16_t nRunAddress = 0x0000;
+	std::string sError;
+};
+
+class ProgramLoader
+{
+public:
+	static LoadResult LoadWozHex(Bus& bus, const std::string& sText);
+	static LoadResult LoadBinary(Bus& bus, const std::vector<uint8_t>& vData, uint16_t nAddr);
+	static LoadResult LoadBinary(Bus& bus, const uint8_t* pData, size_t nSize, uint16_t nAddr);
+
+	// sSpec is "file" for Woz Monitor text, "file.bas" for a BASIC listing or "file@addr" (hex) for a raw binary
+	static LoadResult LoadFile(Bus& bus, const std::string& sSpec);
+
+private:
+	static void Store(Bus& bus, LoadResult& result, uint16_t nAddr, uint8_t data);
+};
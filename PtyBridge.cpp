@@ -0,0 +1,139 @@
+#include "PtyBridge.h"
+
+#include <algorithm>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+PtyBridge::PtyBridge(std::shared_ptr<MOS6551> acia) :
+	acia{ acia }
+{
+	fdMaster = -1;
+	fdSlave = -1;
+	fdWake[0] = -1;
+	fdWake[1] = -1;
+	bStop = false;
+}
+
+PtyBridge::~PtyBridge()
+{
+	if (thread.joinable())
+	{
+		bStop = true;
+		Wake();
+		thread.join();
+	}
+
+	acia->setTransmitHandler(nullptr);
+
+#ifndef _WIN32
+	for (int fd : { fdMaster, fdSlave, fdWake[0], fdWake[1] })
+	{
+		if (fd >= 0)
+			close(fd);
+	}
+#endif
+}
+
+bool PtyBridge::Open(std::string& sError)
+{
+#ifdef _WIN32
+	sError = "serial: pseudo terminals are not available on Windows";
+	return false;
+#else
+	fdMaster = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (fdMaster < 0 || grantpt(fdMaster) != 0 || unlockpt(fdMaster) != 0 || ptsname(fdMaster) == nullptr)
+	{
+		sError = "serial: cannot create a pseudo terminal";
+		return false;
+	}
+	sName = ptsname(fdMaster);
+
+	// raw bytes both ways, no echo or line editing by the tty layer
+	fdSlave = open(sName.c_str(), O_RDWR | O_NOCTTY);
+	termios tio;
+	if (fdSlave < 0 || tcgetattr(fdSlave, &tio) != 0)
+	{
+		sError = "serial: cannot open " + sName;
+		return false;
+	}
+	cfmakeraw(&tio);
+	tcsetattr(fdSlave, TCSANOW, &tio);
+
+	if (pipe(fdWake) != 0)
+	{
+		sError = "serial: cannot create a pipe";
+		return false;
+	}
+	fcntl(fdWake[0], F_SETFL, O_NONBLOCK);
+	fcntl(fdWake[1], F_SETFL, O_NONBLOCK);
+
+	acia->setTransmitHandler([this]() { Wake(); });
+	thread = std::thread(&PtyBridge::ThreadLoop, this);
+	return true;
+#endif
+}
+
+const std::string& PtyBridge::getName()
+{
+	return sName;
+}
+
+void PtyBridge::ThreadLoop()
+{
+#ifndef _WIN32
+	std::vector<uint8_t> vOut;		// transmitted, not yet taken by the pty
+	uint8_t buffer[256];
+
+	while (!bStop)
+	{
+		// only read what the ring takes, the rest waits in the pty
+		size_t nSpace = acia->ReceiveSpace();
+		pollfd fds[2] = {
+			{ fdMaster, (short)((nSpace > 0 ? POLLIN : 0) | (vOut.empty() ? 0 : POLLOUT)), 0 },
+			{ fdWake[0], POLLIN, 0 }
+		};
+		poll(fds, 2, nSpace > 0 ? 100 : 10);
+
+		while (read(fdWake[0], buffer, sizeof(buffer)) > 0);
+
+		if (fds[0].revents & POLLIN)
+		{
+			ssize_t n = read(fdMaster, buffer, std::min(nSpace, sizeof(buffer)));
+			for (ssize_t i = 0; i < n; i++)
+				acia->PushReceived(buffer[i]);
+
+			if (n > 0)
+				acia->Received();
+		}
+
+		// nobody reads the port - leave the rest in the ring, the ACIA drops and
+		// counts what does not fit, like a line without a listener
+		uint8_t data;
+		while (vOut.size() < nMaxPending && acia->PopTransmitted(data))
+			vOut.push_back(data);
+
+		if (!vOut.empty())
+		{
+			ssize_t n = write(fdMaster, vOut.data(), vOut.size());
+			if (n > 0)
+				vOut.erase(vOut.begin(), vOut.begin() + n);
+		}
+	}
+#endif
+}
+
+void PtyBridge::Wake()
+{
+#ifndef _WIN32
+	uint8_t data = 0;
+	if (fdWake[1] >= 0)
+		(void)!write(fdWake[1], &data, 1);
+#endif
+}
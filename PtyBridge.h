@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "MOS6551.h"
+
+/*
+Connects the serial line of a MOS6551 to a pseudo terminal of the host, so
+terminal programs and file transfer tools can open its name (e.g. /dev/pts/3)
+like a serial port. A helper thread moves the bytes between the pty and the
+rings of the ACIA with non-blocking I/O; it sleeps in poll() until the pty has
+data or the ACIA transmitted, the emulation never waits for it.
+
+The slave side is kept open by the bridge, so a program closing the port does
+not hang up the line and the next one can open it again. Not available on
+Windows, Open() fails there.
+*/
+
+class PtyBridge
+{
+public:
+	PtyBridge(std::shared_ptr<MOS6551> acia);
+	~PtyBridge();
+
+public:
+	bool Open(std::string& sError);
+	const std::string& getName();
+
+private:
+	std::shared_ptr<MOS6551> acia;
+	std::string sName;
+
+	int fdMaster;
+	int fdSlave;
+	int fdWake[2];		// the ACIA transmitted, written on the emulation thread
+
+	// transmitted bytes kept while the pty does not take them, further ones wait
+	// in the ACIA's ring until it drops them
+	const static size_t nMaxPending = 64 * 1024;
+
+	std::thread thread;
+	std::atomic<bool> bStop;
+
+	void ThreadLoop();
+	void Wake();
+};
@@ -1,37 +1,36 @@
 #include "Rom.h"
 
 #include <cstdint>
-#include <filesystem>
 #include <string>
 #include <fstream>
 #include <vector>
 
 Rom::Rom(const std::string& sFileName, uint16_t iOffset)
 {
-	std::ifstream ifs;
-
 	// init
 	this->bImageValid = false;
 	this->nOffset = 0;
 	this->nSize = 0;
 
-	// try to read ROM file
-	ifs.open(sFileName, std::ifstream::binary);
-	if (ifs.is_open())
+	// try to map ROM file
+	file = MappedFile::Open(sFileName);
+	if (file)
 	{
-		auto nSize = std::filesystem::file_size(sFileName);
-
-		vMemory.resize(nSize);
-		ifs.read((char*)vMemory.data(), vMemory.size());
-
+		this->pMemory = file->Data();
 		this->nOffset = iOffset;
-		this->nSize = nSize;
+		this->nSize = file->Size();
 		this->bImageValid = true;
-
-		ifs.close();
 	}
 }
 
+Rom::Rom(const uint8_t* pImage, size_t nImageSize, uint16_t iOffset)
+{
+	this->pMemory = pImage;
+	this->nOffset = iOffset;
+	this->nSize = nImageSize;
+	this->bImageValid = pImage != nullptr;
+}
+
 Rom::~Rom()
 {
 }
@@ -48,7 +47,7 @@ bool Rom::cpuRead(uint16_t addr, uint8_t& data)
 		uint32_t mapped_addr = addr - nOffset;
 		if (mapped_addr >= 0 and mapped_addr < nSize)
 		{
-			data = vMemory[mapped_addr];
+			data = pMemory[mapped_addr];
 			return true;
 		}
 	}
@@ -63,6 +62,13 @@ bool Rom::cpuWrite(uint16_t addr, uint8_t data)
 		uint32_t mapped_addr = addr - nOffset;
 		if (mapped_addr >= 0 and mapped_addr < nSize)
 		{
+			// copy on first write
+			if (pMemory != vMemory.data())
+			{
+				vMemory.assign(pMemory, pMemory + nSize);
+				pMemory = vMemory.data();
+			}
+
 			vMemory[mapped_addr] = data;
 			return true;
 		}
@@ -80,3 +86,12 @@ uint16_t Rom::High()
 {
 	return nOffset + nSize - 1;
 }
+
+const uint8_t* Rom::Pointer(uint16_t addr)
+{
+	uint32_t nMapped = (uint32_t)(addr - nOffset);
+	if (addr >= nOffset && nMapped < nSize)
+		return pMemory + nMapped;
+
+	return nullptr;
+}
@@ -1,13 +1,24 @@
 #pragma once
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <fstream>
 #include <vector>
 
+#include "MappedFile.h"
+
+/*
+A ROM image file is memory mapped read only and shared by all Roms of the
+process; an embedded image is used in place. Either is copied only when the
+CPU writes to it.
+*/
+
 class Rom
 {
 public:
 	Rom(const std::string& sFileName, uint16_t iOffset);
+	// embedded image, only copied when written to
+	Rom(const uint8_t* pImage, size_t nImageSize, uint16_t iOffset);
 	~Rom();
 
 public:
@@ -19,10 +30,15 @@ public:
 	uint16_t Low();
 	uint16_t High();
 
+	// the image byte at addr, nullptr outside - moves when the image is copied on a write
+	const uint8_t* Pointer(uint16_t addr);
+
 private:
 	bool bImageValid = false;
 
-	std::vector<uint8_t> vMemory;
+	std::vector<uint8_t> vMemory;		// own copy once written to
+	std::shared_ptr<const MappedFile> file;
+	const uint8_t* pMemory = nullptr;	// vMemory, the mapped file or the embedded image
 	uint16_t nOffset;
 	uintmax_t nSize;
 };
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/*
+Sequence lock for a single writer thread publishing a small trivially copyable
+value to readers that must never block it. The writer makes the sequence odd
+while it stores, a reader retries until it copied the value between two equal
+even sequence numbers. The value is kept in atomic words so that the torn
+copies a reader may see and discard are not a data race.
+*/
+
+template<typename T>
+class Seqlock
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Seqlock value must be trivially copyable");
+
+public:
+	Seqlock()
+	{
+		Store(T());
+	}
+
+	// writer
+	void Store(const T& value)
+	{
+		uint64_t w[nWords] = {};
+		memcpy(w, &value, sizeof(T));
+
+		uint32_t s = nSequence.load(std::memory_order_relaxed);
+		nSequence.store(s + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		for (size_t i = 0; i < nWords; i++)
+			words[i].store(w[i], std::memory_order_relaxed);
+
+		nSequence.store(s + 2, std::memory_order_release);
+	}
+
+	// readers
+	T Load() const
+	{
+		uint64_t w[nWords];
+		uint32_t s1, s2;
+
+		do
+		{
+			s1 = nSequence.load(std::memory_order_acquire);
+
+			for (size_t i = 0; i < nWords; i++)
+				w[i] = words[i].load(std::memory_order_relaxed);
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			s2 = nSequence.load(std::memory_order_relaxed);
+		} while ((s1 & 1) || s1 != s2);
+
+		T value;
+		memcpy(&value, w, sizeof(T));
+		return value;
+	}
+
+private:
+	static const size_t nWords = (sizeof(T) + 7) / 8;
+
+	std::atomic<uint32_t> nSequence{ 0 };
+	std::atomic<uint64_t> words[nWords];
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/*
+Bounded lock-free ring buffer for exactly one producer and one consumer thread.
+Head and tail only ever grow, their difference is the fill level; N must be a
+power of two. Push fails when the ring is full, Pop when it is empty.
+*/
+
+template<typename T, size_t N>
+class SpscRing
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+	// producer
+	bool Push(const T& value)
+	{
+		size_t h = nHead.load(std::memory_order_relaxed);
+		if (h - nTail.load(std::memory_order_acquire) == N)
+			return false;
+
+		buffer[h & (N - 1)] = value;
+		nHead.store(h + 1, std::memory_order_release);
+		return true;
+	}
+
+	// consumer
+	bool Pop(T& value)
+	{
+		size_t t = nTail.load(std::memory_order_relaxed);
+		if (nHead.load(std::memory_order_acquire) == t)
+			return false;
+
+		value = buffer[t & (N - 1)];
+		nTail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+
+	// either side, exact only when called from a side while the other one is idle
+	size_t Size() const
+	{
+		size_t t = nTail.load(std::memory_order_acquire);
+		return nHead.load(std::memory_order_acquire) - t;
+	}
+
+	bool Empty() const
+	{
+		return Size() == 0;
+	}
+
+	bool Full() const
+	{
+		return Size() == N;
+	}
+
+	static constexpr size_t Capacity()
+	{
+		return N;
+	}
+
+private:
+	// producer and consumer index on separate cache lines
+	alignas(64) std::atomic<size_t> nHead{ 0 };
+	alignas(64) std::atomic<size_t> nTail{ 0 };
+	alignas(64) std::array<T, N> buffer;
+};
@@ -0,0 +1,195 @@
+#include "WavFile.h"
+
+#include <algorithm>
+
+static uint32_t LittleEndian(const uint8_t* p, int nBytes)
+{
+	uint32_t n = 0;
+	for (int i = nBytes - 1; i >= 0; i--)
+		n = (n << 8) | p[i];
+	return n;
+}
+
+WavReader::WavReader()
+{
+	nSampleRate = 0;
+	nChannels = 0;
+	nBytesPerSample = 0;
+	nFramesLeft = 0;
+}
+
+WavReader::~WavReader()
+{
+}
+
+bool WavReader::Open(const std::string& sFileName, std::string& sError)
+{
+	ifs.open(sFileName, std::ifstream::binary);
+	if (!ifs.is_open())
+	{
+		sError = "cannot open " + sFileName;
+		return false;
+	}
+
+	uint8_t header[12];
+	if (!ifs.read((char*)header, 12) || std::string((char*)header, 4) != "RIFF" || std::string((char*)header + 8, 4) != "WAVE")
+	{
+		sError = sFileName + " is not a WAV file";
+		return false;
+	}
+
+	// chunks in any order, fmt has to come before data
+	bool bFormat = false;
+	uint8_t chunk[8];
+	while (ifs.read((char*)chunk, 8))
+	{
+		std::string sId((char*)chunk, 4);
+		uint32_t nSize = LittleEndian(chunk + 4, 4);
+
+		if (sId == "fmt ")
+		{
+			std::vector<uint8_t> vFmt(std::max<uint32_t>(nSize, 16));
+			if (!ifs.read((char*)vFmt.data(), nSize))
+				break;
+
+			uint16_t nFormat = (uint16_t)LittleEndian(&vFmt[0], 2);
+			nChannels = (uint16_t)LittleEndian(&vFmt[2], 2);
+			nSampleRate = LittleEndian(&vFmt[4], 4);
+			uint16_t nBits = (uint16_t)LittleEndian(&vFmt[14], 2);
+			nBytesPerSample = (nBits + 7) / 8;
+
+			// 1 = PCM, 0xFFFE = extensible (PCM sub format assumed)
+			if ((nFormat != 1 && nFormat != 0xFFFE) || nChannels == 0 || nSampleRate == 0 || nBytesPerSample == 0 || nBytesPerSample > 4)
+			{
+				sError = sFileName + ": only integer PCM WAV files are supported";
+				return false;
+			}
+			bFormat = true;
+		}
+		else if (sId == "data")
+		{
+			if (!bFormat)
+				break;
+
+			nFramesLeft = nSize / (nChannels * nBytesPerSample);
+			return true;
+		}
+		else
+		{
+			ifs.seekg(nSize, std::ios::cur);
+		}
+
+		// chunks are word aligned
+		if (nSize & 1)
+			ifs.seekg(1, std::ios::cur);
+	}
+
+	sError = sFileName + ": no audio data";
+	return false;
+}
+
+uint32_t WavReader::getSampleRate()
+{
+	return nSampleRate;
+}
+
+size_t WavReader::Read(int16_t* pSamples, size_t nMax)
+{
+	size_t nFrames = (size_t)std::min<uint64_t>(nMax, nFramesLeft);
+	size_t nFrameBytes = nChannels * nBytesPerSample;
+
+	vRaw.resize(nFrames * nFrameBytes);
+	if (nFrames == 0 || !ifs.read((char*)vRaw.data(), vRaw.size()))
+	{
+		nFramesLeft = 0;
+		nFrames = (size_t)ifs.gcount() / nFrameBytes;
+		if (nFrames == 0)
+			return 0;
+	}
+	nFramesLeft -= nFrames;
+
+	// first channel, most significant 16 bits - 8 bit data is unsigned
+	const uint8_t* p = vRaw.data();
+	if (nBytesPerSample == 1)
+	{
+		for (size_t i = 0; i < nFrames; i++, p += nFrameBytes)
+			pSamples[i] = (int16_t)((p[0] - 128) << 8);
+	}
+	else
+	{
+		for (size_t i = 0; i < nFrames; i++, p += nFrameBytes)
+			pSamples[i] = (int16_t)(p[nBytesPerSample - 2] | (p[nBytesPerSample - 1] << 8));
+	}
+
+	return nFrames;
+}
+
+WavWriter::WavWriter()
+{
+	nDataBytes = 0;
+}
+
+WavWriter::~WavWriter()
+{
+	Close();
+}
+
+bool WavWriter::Open(const std::string& sFileName, uint32_t nSampleRate)
+{
+	ofs.open(sFileName, std::ofstream::binary | std::ofstream::trunc);
+	if (!ofs.is_open())
+		return false;
+
+	// 8 bit mono PCM, sizes are written by Close()
+	uint8_t header[44] = {
+		'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E',
+		'f', 'm', 't', ' ', 16, 0, 0, 0, 1, 0, 1, 0,
+		(uint8_t)nSampleRate, (uint8_t)(nSampleRate >> 8), (uint8_t)(nSampleRate >> 16), (uint8_t)(nSampleRate >> 24),
+		(uint8_t)nSampleRate, (uint8_t)(nSampleRate >> 8), (uint8_t)(nSampleRate >> 16), (uint8_t)(nSampleRate >> 24),
+		1, 0, 8, 0,
+		'd', 'a', 't', 'a', 0, 0, 0, 0
+	};
+	ofs.write((char*)header, sizeof(header));
+	nDataBytes = 0;
+	return true;
+}
+
+void WavWriter::Close()
+{
+	if (!ofs.is_open())
+		return;
+
+	auto Patch = [this](std::streamoff nPos, uint32_t n)
+	{
+		uint8_t v[4] = { (uint8_t)n, (uint8_t)(n >> 8), (uint8_t)(n >> 16), (uint8_t)(n >> 24) };
+		ofs.seekp(nPos);
+		ofs.write((char*)v, 4);
+	};
+
+	if (nDataBytes & 1)
+		ofs.put(0);
+	Patch(4, 36 + nDataBytes + (nDataBytes & 1));
+	Patch(40, nDataBytes);
+	ofs.close();
+}
+
+void WavWriter::Write(bool bHigh, uint64_t nSamples)
+{
+	if (!ofs.is_open())
+		return;
+
+	// a WAV file ends at 4 GB
+	nSamples = std::min<uint64_t>(nSamples, 0xFFFFFF00u - nDataBytes);
+
+	static const size_t nChunk = 4096;
+	char chunk[nChunk];
+	std::fill(chunk, chunk + nChunk, (char)(bHigh ? 0xC0 : 0x40));
+
+	nDataBytes += (uint32_t)nSamples;
+	while (nSamples > 0)
+	{
+		size_t n = (size_t)std::min<uint64_t>(nSamples, nChunk);
+		ofs.write(chunk, n);
+		nSamples -= n;
+	}
+}
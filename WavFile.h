@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+Streaming access to PCM WAV files for the cassette interface. WavReader
+delivers the first channel as signed 16 bit samples, a block at a time, so a
+tape of any length is decoded with a fixed amount of memory; 8, 16, 24 and
+32 bit integer formats are accepted. WavWriter records a square wave as 8 bit
+mono and fixes up the header sizes when closed.
+*/
+
+class WavReader
+{
+public:
+	WavReader();
+	~WavReader();
+
+	bool Open(const std::string& sFileName, std::string& sError);
+	uint32_t getSampleRate();
+
+	// reads up to nMax samples of the first channel, returns 0 at the end of the data
+	size_t Read(int16_t* pSamples, size_t nMax);
+
+private:
+	std::ifstream ifs;
+	uint32_t nSampleRate;
+	uint16_t nChannels;
+	uint16_t nBytesPerSample;
+	uint64_t nFramesLeft;
+	std::vector<uint8_t> vRaw;
+};
+
+class WavWriter
+{
+public:
+	WavWriter();
+	~WavWriter();
+
+	bool Open(const std::string& sFileName, uint32_t nSampleRate);
+	void Close();
+
+	// nSamples of a square wave at the given level
+	void Write(bool bHigh, uint64_t nSamples);
+
+private:
+	std::ofstream ofs;
+	uint32_t nDataBytes;
+};
@@ -0,0 +1,118 @@
+#include "WorkStealingPool.h"
+
+WorkStealingPool::WorkStealingPool(size_t nThreads)
+{
+	if (nThreads == 0)
+		nThreads = std::thread::hardware_concurrency();
+	if (nThreads == 0)
+		nThreads = 1;
+
+	nPending = 0;
+	nQueued = 0;
+	nNextWorker = 0;
+	bStop = false;
+
+	for (size_t i = 0; i < nThreads; i++)
+		vWorkers.push_back(std::make_unique<Worker>());
+
+	for (size_t i = 0; i < nThreads; i++)
+		vThreads.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mtxState);
+		bStop = true;
+	}
+	cvWork.notify_all();
+
+	for (auto& t : vThreads)
+		t.join();
+}
+
+void WorkStealingPool::Submit(std::function<void()> task)
+{
+	size_t nWorker;
+	{
+		std::lock_guard<std::mutex> lock(mtxState);
+		nWorker = nNextWorker;
+		nNextWorker = (nNextWorker + 1) % vWorkers.size();
+		nPending++;
+		nQueued++;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(vWorkers[nWorker]->mtx);
+		vWorkers[nWorker]->tasks.push_back(std::move(task));
+	}
+
+	cvWork.notify_one();
+}
+
+void WorkStealingPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(mtxState);
+	cvDone.wait(lock, [&] { return nPending == 0; });
+}
+
+size_t WorkStealingPool::ThreadCount()
+{
+	return vThreads.size();
+}
+
+bool WorkStealingPool::PopTask(size_t nSelf, std::function<void()>& task)
+{
+	// own work first - newest task from the back
+	{
+		Worker& w = *vWorkers[nSelf];
+		std::lock_guard<std::mutex> lock(w.mtx);
+		if (!w.tasks.empty())
+		{
+			task = std::move(w.tasks.back());
+			w.tasks.pop_back();
+			nQueued--;
+			return true;
+		}
+	}
+
+	// then steal oldest task from another worker
+	for (size_t i = 1; i < vWorkers.size(); i++)
+	{
+		Worker& w = *vWorkers[(nSelf + i) % vWorkers.size()];
+		std::lock_guard<std::mutex> lock(w.mtx);
+		if (!w.tasks.empty())
+		{
+			task = std::move(w.tasks.front());
+			w.tasks.pop_front();
+			nQueued--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void WorkStealingPool::WorkerLoop(size_t nSelf)
+{
+	std::function<void()> task;
+
+	while (true)
+	{
+		if (PopTask(nSelf, task))
+		{
+			task();
+			task = nullptr;
+
+			std::lock_guard<std::mutex> lock(mtxState);
+			if (--nPending == 0)
+				cvDone.notify_all();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mtxState);
+		cvWork.wait(lock, [&] { return bStop || nQueued > 0; });
+		if (bStop && nQueued == 0)
+			return;
+	}
+}
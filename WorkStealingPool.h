@@ -0,0 +1,50 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Simple work stealing thread pool: each worker owns a task deque and takes work
+from its back; an idle worker steals from the front of the other workers' deques.
+Tasks are expected to be coarse (e.g. one emulated machine run), so each deque is
+guarded by a plain mutex.
+*/
+
+class WorkStealingPool
+{
+public:
+	WorkStealingPool(size_t nThreads = 0);
+	~WorkStealingPool();
+
+	void Submit(std::function<void()> task);
+	void Wait();
+
+	size_t ThreadCount();
+
+private:
+	struct Worker
+	{
+		std::mutex mtx;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	std::vector<std::unique_ptr<Worker>> vWorkers;
+	std::vector<std::thread> vThreads;
+
+	std::mutex mtxState;
+	std::condition_variable cvWork;
+	std::condition_variable cvDone;
+	std::atomic<size_t> nPending;	// submitted, not yet finished
+	std::atomic<size_t> nQueued;	// submitted, not yet picked up by a worker
+	size_t nNextWorker;
+	bool bStop;
+
+	bool PopTask(size_t nSelf, std::function<void()>& task);
+	void WorkerLoop(size_t nSelf);
+};
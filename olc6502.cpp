@@ -220,11 +220,13 @@ void olc6502::irq()
 		write(0x0100 + stkp, pc & 0x00FF);
 		stkp--;
 
-		// Then Push the status register to the stack
+		// Then Push the status register to the stack, with I as it was
+		// so RTI enables interrupts again
 		SetFlag(B, 0);
-		SetFlag(I, 1);
+		SetFlag(U, 1);
 		write(0x0100 + stkp, status);
 		stkp--;
+		SetFlag(I, 1);
 
 		// Read new program counter location from fixed address
 		addr_abs = 0xFFFE;
@@ -249,9 +251,10 @@ void olc6502::nmi()
 	stkp--;
 
 	SetFlag(B, 0);
-	SetFlag(I, 1);
+	SetFlag(U, 1);
 	write(0x0100 + stkp, status);
 	stkp--;
+	SetFlag(I, 1);
 
 	addr_abs = 0xFFFA;
 	uint16_t lo = read(addr_abs + 0);